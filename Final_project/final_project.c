@@ -3,6 +3,7 @@
  * RESOURCES USED
  *  - PIO state machines 0, 1, and 2 on PIO instance 0
  *  - DMA channels 0, 1, 2, and 3
+ *  - two more (claimed) DMA channels and a DMA pacing timer for the DAC
  *
  * Protothreads v1.1.1
  * Serial console on GPIO 0 and 1 for debugging
@@ -21,10 +22,12 @@
  * ==========
  * Core1:
  *
- * -- synthesis ISR triggered by a timer alarm
- * ---- runs at 40KHz (25 uSec interval) for audio synthesis.
- * ---- Computes DDS to get modulating wave, then computes output wave
- * ---- Pushes output to an SPI channel
+ * -- synthesis ISR triggered by DMA block completion
+ * ---- two DMA channels ping-pong AUDIO_BLOCK_SIZE frame blocks into the
+ * ---- SPI DAC, paced at 27.7, 32, 44.1 or 48 KHz by a DMA timer DREQ
+ * ---- each frame is a channel A (left) and a channel B (right) word
+ * ---- the ISR renders the next block (synth.c) while the other one plays
+ * ---- with every second voice handed to core 0 over the SIO FIFO
  */
 
 #include "vga16_graphics.h"
@@ -37,12 +40,18 @@
 #include "hardware/pwm.h"
 #include "hardware/irq.h"
 #include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/xip_ctrl.h"
 
 // ==========================================
 // === hardware and protothreads globals
 // ==========================================
 #include "hardware/sync.h"
 #include "song.h"
+#include "song_index.h"
+#include "sequencer.h"
+#include "synth.h"
 #include "hardware/timer.h"
 #include "pico/multicore.h"
 #include "string.h"
@@ -68,17 +77,17 @@ static float conversion_factor = 3.3f / (1 << 12);
 #define INSTRUMENT3_BUTTON 3
 #define INSTRUMENT4_BUTTON 15
 
-#define NUM_SONGS 5
+// one button per song; with more songs than buttons the last one steps
+// through the rest
+#define NUM_SONG_BUTTONS 5
+// playsong tops up the song queue this often, well inside SEQ_LOOKAHEAD
+#define SEQ_PUMP_US 1000
 #define NUM_INSTRUMENTS 4
 
 
-int song_buttons[NUM_SONGS] = {SONG1_BUTTON, SONG2_BUTTON, SONG3_BUTTON, SONG4_BUTTON, SONG5_BUTTON}; 
+int song_buttons[NUM_SONG_BUTTONS] = {SONG1_BUTTON, SONG2_BUTTON, SONG3_BUTTON, SONG4_BUTTON, SONG5_BUTTON}; 
 int instrument_buttons[NUM_INSTRUMENTS] = {INSTRUMENT1_BUTTON, INSTRUMENT2_BUTTON, INSTRUMENT3_BUTTON, INSTRUMENT4_BUTTON};
 
-int song_speeds[NUM_SONGS] = {4, 2, 2, 4, 1};
-
-note_t* chosen_song;
-long chosen_song_len;
 
 void ADC_setup(void) {
     adc_init();
@@ -113,11 +122,96 @@ struct menu_item {
 // build the menu array of item parameters to tune values for different 
 // instruments
 struct menu_item menu[16];
-#define menu_length 11
+#define menu_length SYNTH_MENU_LENGTH
+
+// ======
+// Parameter groups derived from the menu. Core 0 bumps a group's version
+// whenever it changes a menu item; protothread_FM on core 1 recomputes a
+// group only when its version has moved. Each version has a single writer
+// so no lock is needed across cores.
+enum param_group { PARAM_GROUP_PITCH, PARAM_GROUP_AMP_ENV, PARAM_GROUP_MOD_ENV, NUM_PARAM_GROUPS };
+#define PARAM_PITCH   (1u << PARAM_GROUP_PITCH)    // DDS increments
+#define PARAM_AMP_ENV (1u << PARAM_GROUP_AMP_ENV)  // amplitude envelope
+#define PARAM_MOD_ENV (1u << PARAM_GROUP_MOD_ENV)  // FM depth and its envelope
+#define PARAM_ALL     ((1u << NUM_PARAM_GROUPS) - 1)
+
+volatile unsigned int param_version[NUM_PARAM_GROUPS] = {1, 1, 1};
+// groups each menu item feeds
+static const unsigned int menu_params[menu_length] = {
+    PARAM_PITCH,    // Octave #
+    PARAM_AMP_ENV,  // Attack main
+    PARAM_AMP_ENV,  // Sustain main
+    PARAM_AMP_ENV,  // Decay main
+    PARAM_PITCH,    // Fmod/Fmain
+    PARAM_MOD_ENV,  // FM depth max
+    PARAM_MOD_ENV,  // Attack FM
+    PARAM_MOD_ENV,  // Sustain FM
+    PARAM_MOD_ENV,  // Decay FM
+    PARAM_AMP_ENV,  // Lin=1/Quad DK
+    0,              // Run
+};
+// core 1 time spent recomputing parameters
+unsigned int fm_busy_us, fm_passes;
+
+// core 0 only: publish a change to the groups in mask
+void mark_params_dirty(unsigned int mask) {
+    // menu values must land before the version does
+    __dmb();
+    for (int g = 0; g < NUM_PARAM_GROUPS; g++) {
+        if (mask & (1u << g)) param_version[g]++;
+    }
+}
+
+// core 1 only: groups changed since seen[], and catch seen[] up
+unsigned int params_dirty(unsigned int *seen) {
+    unsigned int mask = 0;
+    for (int g = 0; g < NUM_PARAM_GROUPS; g++) {
+        unsigned int v = param_version[g];
+        if (v != seen[g]) {
+            seen[g] = v;
+            mask |= 1u << g;
+        }
+    }
+    __dmb();
+    return mask;
+}
+
+// ======
+// Menu sequence count. Core 0 makes it odd while it writes menu values
+// and even again when done, core 1 copies the values out and keeps the
+// copy only if the count was even and unchanged across it. A preset is
+// one write, so core 1 never builds parameters from half of two presets.
+volatile unsigned int menu_seq = 0;
+
+// core 0 only: bracket a group of menu writes
+void menu_write_begin(void) {
+    menu_seq++;
+    __dmb();
+}
+
+void menu_write_end(unsigned int mask) {
+    __dmb();
+    menu_seq++;
+    mark_params_dirty(mask);
+}
+
+// core 1 only: consistent copy of the menu values, false if a write was
+// in progress and the copy must be retried
+bool menu_snapshot(float *values) {
+    unsigned int seq = menu_seq;
+    if (seq & 1) return false;
+    __dmb();
+    for (int i = 0; i < menu_length; i++) {
+        values[i] = menu[i].item_float_value;
+    }
+    __dmb();
+    return seq == menu_seq;
+}
 
 // ===== change value with serial
 // direction is 1 for increase,  -1 for decrease
 void change_value_serial(int index, float value) {
+    menu_write_begin();
     menu[index].item_float_value = value;
     // check min/max
     if (menu[index].item_float_value > menu[index].item_float_max)
@@ -126,40 +220,14 @@ void change_value_serial(int index, float value) {
         menu[index].item_float_value = menu[index].item_float_min;
     // update integer to match
     menu[index].item_int_value = (int)menu[index].item_float_value;
+    menu_write_end(menu_params[index]);
 }
 
-// ==========================================
-// === fixed point s19x12 for DDS
-// ==========================================
-// s19x12 fixed point macros == for DDS
-typedef signed int fix;
-#define mul(a,b) ((fix)(((( signed long long )(a))*(( signed long long )(b)))>>12)) //multiply two fixed 16:16
-#define float_to_fix(a) ((fix)((a)*4096.0)) // 2^12
-#define fix_to_float(a) ((float)(a)/4096.0)
-#define fix_to_int(a)    ((int)((a)>>12))
-#define int_to_fix(a)    ((fix)((a)<<12))
-#define div(a,b) ((fix)((((signed long long)(a)<<12)/(b)))) 
-#define absfix(a) abs(a)
-typedef signed short s1x14;
-#define muls1x14(a,b) ((s1x14)((((int)(a))*((int)(b)))>>14)) 
-#define float_to_s1x14(a) ((s1x14)((a)*16384.0)) // 2^14
-#define s1x14_to_float(a) ((float)(a)/16384.0)
-#define abss1x14(a) abs(a) 
-#define divs1x14(a,b) ((s1x14)((((signed int)(a)<<14)/(b)))) 
-// shift 12 bits into 14 bits so full scale dds is about 0.25
-#define dds_to_s1x14(a) ((s1x14)((a)>>14))
-
 // ==========================================
 // === set up SPI DAC
 // ==========================================
 // All SPI DAC setup was gotten from HUnter Adams
 // https://vanhunteradams.com/Pico/TimerIRQ/SPI_DDS.html
-// DAC parameters
-// A-channel, 1x, active
-#define DAC_config_chan_A 0b0011000000000000
-// B-channel, 1x, active
-#define DAC_config_chan_B 0b1011000000000000
-
 //SPI configurations
 #define PIN_CS   5
 #define PIN_SCK  6
@@ -174,176 +242,365 @@ static int mux_select = 0;
 static float voltage1 = 3;
 static float voltage2 = 3;
 
-// data for the spi port
-uint16_t DAC_data;
-
 // ==========================================
-// === set up DDS and timer ISR
+// === set up DDS and DAC DMA
 // ==========================================
-// 1/Fs in microseconds ~ 27.7kHz
-volatile int alarm_period = 36;
+// output rates in Hz, picked with the "rate" command. 27778 is about the
+// original 36 uSec period.
+static const int rate_choices[] = {27778, 32000, 44100, 48000};
+#define NUM_RATE_CHOICES (sizeof(rate_choices) / sizeof(rate_choices[0]))
+// requested by core 0, applied by protothread_FM on core 1
+volatile int requested_rate = 27778;
+
+// sample playback instead of FM for new notes, set by the "pcm" command
+volatile bool use_pcm = false;
+// "duet" command: 0 spreads every note by key, 1 is always the duet, 2
+// switches to the duet while a song plays and back after it
+enum { DUET_OFF, DUET_ON, DUET_WITH_SONG };
+static volatile int duet_setting = DUET_WITH_SONG;
+static volatile bool song_playing;
+// what the DMA timer is running at
+int sample_rate;
+float dac_fs;                   // actual rate, Hz
+static uint32_t dac_fs_num, dac_fs_den;
 
-#define NUM_KEYS 50
 #define NUM_PHYSICAL_KEYS 16
 #define VOLTAGE_CUTOFF 1.2
-#define BUFFER_COUNT 8
-
-// DDS variables 
-unsigned int mod_inc[NUM_KEYS], main_inc[NUM_KEYS];
-unsigned int current_mod_inc[NUM_KEYS], current_main_inc[NUM_KEYS];
-unsigned int mod_accum[NUM_KEYS], main_accum[NUM_KEYS];
-
-// amplitude paramters
-fix max_mod_depth;
-fix current_mod_depth[NUM_KEYS];
-// waveform amplities -- must fit in +/-11 bits for DAC
-fix max_amp = float_to_fix(1000.0);
-fix current_amp[NUM_KEYS];
-
-// timing in seconds
-static volatile fix attack_time, mod_attack_time;
-static volatile fix decay_time, mod_decay_time, recip_decay_time;
-static volatile fix sustain_time, mod_sustain_time;
-fix onefix = int_to_fix(1);
-// internal timing in samples
-fix note_time[NUM_KEYS];
-static volatile fix attack_inc, decay_inc, mod_attack_inc, mod_decay_inc;
-// sine waves
-fix sine_table[256];
-fix mod_wave[NUM_KEYS], main_wave[NUM_KEYS];
+
 // inputs
-float Fs, Fmod;
+float Fs;
 
-int base_note = 36;
-float notes[NUM_KEYS];
-int note_start[NUM_KEYS], play_note[NUM_KEYS], add_delay[NUM_KEYS], buffer[BUFFER_COUNT];
-bool pressed[NUM_KEYS], prev_pressed[NUM_KEYS], play_song[NUM_SONGS];
-int linear_dk = 0;
+int base_note = SYNTH_TABLE_BASE_NOTE;
+int play_note[NUM_KEYS];
+
+// key state seen by the input threads
+bool pressed[NUM_KEYS], prev_pressed[NUM_KEYS];
+bool play_song[SONG_COUNT];
 int octave_num;
 
+// ping-pong sample blocks -- DMA sends one while the ISR fills the other
+static uint16_t dac_block[2][SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+static int dac_chan[2];
+static int dac_timer;
+static uint32_t cycles_per_us;
+static uint32_t cycles_per_sample;
+
+// sample clock for stamping notes: when the ISR began rendering, and the
+// first sample of the block after it. Sequence count as for the menu.
+static volatile uint32_t dac_clock_seq, dac_clock_us, dac_clock_start;
+// block to block intervals seen by the ISR since the last rate change,
+// for the measured sample period and its spread. The DMA timer paces the
+// DAC exactly; the spread here is ISR entry latency, an upper bound on
+// any error in the output clock itself.
+static volatile uint32_t clock_blocks;
+static volatile uint64_t clock_sum_us, clock_sum_sq;
+// render time of those blocks, the measured headroom at this rate
+static volatile uint32_t render_max_us;
+static volatile uint64_t render_sum_us;
+
+#define DAC_DMA_IRQ DMA_IRQ_1
+
 // ==========================================
-// === set up timer ISR  used in this pgm
+// === DAC DMA ISR -- runs on core 1
 // ==========================================
-// === timer alarm ========================
-
-#define ALARM_NUM 1
-#define ALARM_IRQ TIMER_IRQ_1
-// ISR interval will be 10 uSec
-//
-// the actual ISR
-void compute_sample(void);
-//
-static void alarm_irq(void) {
+// A block has just finished and the other channel is already playing,
+// so there is one block time to render the next one.
+static void dac_dma_irq(void) {
     // mark ISR entry
     gpio_put(2, 1);
-    // Clear the alarm irq
-    hw_clear_bits(&timer_hw->intr, 1u << ALARM_NUM);
-    // arm the next interrupt
-    // Write the lower 32 bits of the target time to the alarm to arm it
-    timer_hw->alarm[ALARM_NUM] = timer_hw->timerawl + alarm_period;
-    //
-    compute_sample();
-
+    for (int b = 0; b < 2; b++) {
+        if (dma_hw->ints1 & (1u << dac_chan[b])) {
+            dma_hw->ints1 = 1u << dac_chan[b];
+            // rewind, the other channel will retrigger this one when it is done
+            dma_channel_set_read_addr(dac_chan[b], dac_block[b], false);
+            uint32_t render_start = timer_hw->timerawl;
+            synth_render_block(dac_block[b], AUDIO_BLOCK_SIZE);
+            uint32_t render_us = timer_hw->timerawl - render_start;
+            // feed the render time back so polyphony stays inside the budget
+            synth_block_timing(render_us * cycles_per_us, AUDIO_BLOCK_SIZE);
+            dac_clock_seq++;
+            __dmb();
+            if (clock_blocks || dac_clock_us) {
+                uint32_t dt = render_start - dac_clock_us;
+                clock_sum_us += dt;
+                clock_sum_sq += (uint64_t)dt * dt;
+                clock_blocks++;
+                render_sum_us += render_us;
+                if (render_us > render_max_us) render_max_us = render_us;
+            }
+            dac_clock_us = render_start;
+            dac_clock_start = synth_samples;
+            __dmb();
+            dac_clock_seq++;
+        }
+    }
     // mark ISR exit
     gpio_put(2, 0);
 }
 
-// set up the timer alarm ISR
-static void alarm_in_us(uint32_t delay_us) {
-    // Enable the interrupt for our alarm (the timer outputs 4 alarm irqs)
-    hw_set_bits(&timer_hw->inte, 1u << ALARM_NUM);
-    // Set irq handler for alarm irq
-    irq_set_exclusive_handler(ALARM_IRQ, alarm_irq);
-    // Enable the alarm irq
-    irq_set_enabled(ALARM_IRQ, true);
-    // Enable interrupt in block and at processor
-    // Alarm is only 32 bits 
-    uint64_t target = timer_hw->timerawl + delay_us;
-    // Write the lower 32 bits of the target time to the alarm which
-    // will arm it
-    timer_hw->alarm[ALARM_NUM] = (uint32_t)target;
+// Sample a note posted now should land on. Everything up to
+// dac_clock_start is already rendered, so notes go into the next block at
+// their offset into the current block period -- a fixed latency of one
+// block plus the DMA buffer, with no scheduler jitter on the start.
+uint32_t note_time(void) {
+    uint32_t seq, at, start;
+    do {
+        seq = dac_clock_seq;
+        __dmb();
+        at = dac_clock_us;
+        start = dac_clock_start;
+        __dmb();
+    } while ((seq & 1) || seq != dac_clock_seq);
+    uint32_t elapsed = time_us_32() - at;
+    // a block is at most ~2.3 mSec, and this keeps the product in 32 bits
+    if (elapsed > 10000) elapsed = 10000;
+    uint32_t offset = elapsed * (uint32_t)sample_rate / 1000000;
+    if (offset >= AUDIO_BLOCK_SIZE) offset = AUDIO_BLOCK_SIZE - 1;
+    return start + offset;
 }
 
-void add_note(int note);
-void remove_note(int note);
-void print_notes(void);
-
-void set_chosen_song(int song_num) {
-    switch (song_num) {
-        case 0: 
-            chosen_song = song_data1;
-            chosen_song_len = song_len1;
-            break; 
-        case 1: 
-            chosen_song = song_data2; 
-            chosen_song_len = song_len2;
-            break;
-        case 2: 
-            chosen_song = song_data3; 
-            chosen_song_len = song_len3;
-            break;
-        case 3: 
-            chosen_song = song_data4; 
-            chosen_song_len = song_len4;
-            break;
-        case 4: 
-            chosen_song = song_data5; 
-            chosen_song_len = song_len5;
-            break;
-        default: 
-            chosen_song = song_data1; 
-            chosen_song_len = song_len1; 
+// ==========================================
+// === core 0 render helper
+// ==========================================
+// In dual mode the DMA ISR on core 1 hands every second voice of each
+// span to core 0 through the SIO FIFO. Core 0 renders them from its FIFO
+// interrupt, the highest priority one on that core, which preempts the
+// protothreads wherever they are, and answers on the FIFO. Nothing on
+// core 0 may therefore hold a voice or mix buffer across an instruction
+// boundary: threads touch the synth only through the note queues and
+// the parameter block swap.
+#define RENDER_JOB 1u
+#define RENDER_IRQ_PRIORITY 0x40  // above everything else on core 0
+
+// core 0 FIFO interrupt
+static void render_helper_irq(void) {
+    while (multicore_fifo_rvalid()) {
+        if (multicore_fifo_pop_blocking() == RENDER_JOB) {
+            __dmb();
+            synth_helper_render();
+            __dmb();
+            multicore_fifo_push_blocking(RENDER_JOB);
+        }
     }
+    multicore_fifo_clear_irq();
+}
+
+// core 1, inside the DMA ISR
+static void render_helper_start(void) {
+    __dmb();
+    multicore_fifo_push_blocking(RENDER_JOB);
+}
+
+static void render_helper_wait(void) {
+    while (multicore_fifo_pop_blocking() != RENDER_JOB) ;
+    __dmb();
+}
+
+// core 0, after core 1 has been launched so the launch handshake is done
+static void render_helper_init(void) {
+    synth_helper_start = render_helper_start;
+    synth_helper_wait = render_helper_wait;
+    multicore_fifo_drain();
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(SIO_IRQ_PROC0, render_helper_irq);
+    irq_set_priority(SIO_IRQ_PROC0, RENDER_IRQ_PRIORITY);
+    irq_set_enabled(SIO_IRQ_PROC0, true);
+    synth_set_dual(true);
+}
+
+// ==========================================
+// === sample rate
+// ==========================================
+// The DMA timer fires sys_clk * x / y times a second, x and y 16 bits.
+// Take the x/y nearest rate/sys_clk; 48 and 32 kHz are exact at 125 MHz,
+// 44.1 kHz is within a ppm.
+static void dac_rate_fraction(uint32_t clk, uint32_t rate, uint32_t *num, uint32_t *den) {
+    uint32_t best_x = 1, best_y = (clk + rate / 2) / rate;
+    uint64_t best_err = ~0ull;
+    for (uint32_t x = 1; x <= 0xffff; x++) {
+        uint64_t y = ((uint64_t)x * clk + rate / 2) / rate;
+        if (y > 0xffff) break;
+        // |x*clk/y - rate| compared across candidates without dividing
+        uint64_t diff = (uint64_t)x * clk > y * rate ? (uint64_t)x * clk - y * rate : y * rate - (uint64_t)x * clk;
+        if (diff * best_y < best_err * y || best_err == ~0ull) {
+            best_x = x;
+            best_y = y;
+            best_err = diff;
+            if (diff == 0) break;
+        }
+    }
+    *num = best_x;
+    *den = best_y;
+}
+
+// core 1 only: retime the DAC DMA and the voice budget for a new rate
+static void dac_set_rate(int rate) {
+    uint32_t clk = clock_get_hz(clk_sys);
+    // one DREQ per DAC word, both channels of every frame
+    dac_rate_fraction(clk, rate * SYNTH_CHANNELS, &dac_fs_num, &dac_fs_den);
+    dma_timer_set_fraction(dac_timer, dac_fs_num, dac_fs_den);
+    sample_rate = rate;
+    dac_fs = (float)clk * dac_fs_num / dac_fs_den / SYNTH_CHANNELS;
+    // and that many cycles to render each sample
+    cycles_per_sample = clk / rate;
+    synth_set_budget(cycles_per_sample);
+    // measure the new rate from scratch, with the ISR (the other writer)
+    // held off
+    uint32_t irq = save_and_disable_interrupts();
+    dac_clock_seq++;
+    __dmb();
+    clock_blocks = 0;
+    clock_sum_us = 0;
+    clock_sum_sq = 0;
+    render_sum_us = 0;
+    render_max_us = 0;
+    dac_clock_us = 0;
+    __dmb();
+    dac_clock_seq++;
+    restore_interrupts(irq);
+}
+
+// measured sample period from the block interrupts
+static void print_sample_clock(void) {
+    uint32_t seq, n;
+    uint64_t sum, sq;
+    do {
+        seq = dac_clock_seq;
+        __dmb();
+        n = clock_blocks;
+        sum = clock_sum_us;
+        sq = clock_sum_sq;
+        __dmb();
+    } while ((seq & 1) || seq != dac_clock_seq);
+    if (n == 0) {
+        printf("sample clock: no blocks yet\n");
+        return;
+    }
+    double mean = (double)sum / n;
+    double var = (double)sq / n - mean * mean;
+    printf("sample clock: %lu blocks, period %.2f nSec (%.2f Hz), block jitter %.2f uSec rms\n",
+        (unsigned long)n, 1000.0 * mean / AUDIO_BLOCK_SIZE, 1e6 * AUDIO_BLOCK_SIZE / mean,
+        var > 0 ? sqrt(var) : 0.0);
+}
+
+// does the rate leave room for the requested polyphony, by the cost
+// model and by the render times measured since the rate was set
+static void print_rate_budget(void) {
+    uint32_t seq, n, max_us;
+    uint64_t sum_us;
+    printf("rate %d Hz (timer %lu/%lu, actual %.3f Hz), %lu cycles per sample\n",
+        sample_rate, (unsigned long)dac_fs_num, (unsigned long)dac_fs_den, dac_fs,
+        (unsigned long)cycles_per_sample);
+    printf("budget allows %d of %d voices at %lu cycles per voice-sample%s\n", voice_limit, polyphony,
+        (unsigned long)synth_voice_cycles(use_pcm ? VOICE_PCM : VOICE_FM), voice_limit < polyphony ? " -- rate does not fit the polyphony" : "");
+    do {
+        seq = dac_clock_seq;
+        __dmb();
+        n = clock_blocks;
+        sum_us = render_sum_us;
+        max_us = render_max_us;
+        __dmb();
+    } while ((seq & 1) || seq != dac_clock_seq);
+    if (n == 0) {
+        printf("render load: no blocks yet\n");
+        return;
+    }
+    float block_us = 1e6f * AUDIO_BLOCK_SIZE / dac_fs;
+    printf("render load: %lu blocks, mean %.1f uSec (%.0f%%), worst %lu uSec (%.0f%%) of %.1f uSec\n",
+        (unsigned long)n, (double)sum_us / n, 100.0 * sum_us / n / block_us,
+        (unsigned long)max_us, 100.0 * max_us / block_us, block_us);
+}
+
+// XIP cache hits and per-voice cost, to see how many sampled voices fit.
+// The counters take every flash access, code as well as PCM data.
+static void print_pcm_stats(void) {
+    uint32_t hit = xip_ctrl_hw->ctr_hit;
+    uint32_t acc = xip_ctrl_hw->ctr_acc;
+    printf("XIP cache: %lu of %lu accesses hit (%.1f%%)\n", (unsigned long)hit, (unsigned long)acc,
+        acc ? 100.0 * hit / acc : 0.0);
+    printf("cycles per voice-sample: FM %lu, PCM %lu; %s for new notes, budget allows %d\n",
+        (unsigned long)synth_voice_cycles(VOICE_FM), (unsigned long)synth_voice_cycles(VOICE_PCM),
+        use_pcm ? "PCM" : "FM", voice_limit);
+    // writing clears, so each report covers the time since the last one
+    xip_ctrl_hw->ctr_hit = 0;
+    xip_ctrl_hw->ctr_acc = 0;
+}
+
+// set up the two chained DMA channels feeding the SPI DAC
+static void dac_dma_init(void) {
+    dac_chan[0] = dma_claim_unused_channel(true);
+    dac_chan[1] = dma_claim_unused_channel(true);
+    dac_timer = dma_claim_unused_timer(true);
+    cycles_per_us = clock_get_hz(clk_sys) / 1000000;
+    // DMA pacing, budget and sample clock
+    dac_set_rate(requested_rate);
+
+    for (int b = 0; b < 2; b++) {
+        dma_channel_config c = dma_channel_get_default_config(dac_chan[b]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_16);  // one DAC word per transfer
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, dma_get_timer_dreq(dac_timer));
+        channel_config_set_chain_to(&c, dac_chan[!b]);            // ping-pong
+        dma_channel_configure(
+            dac_chan[b],
+            &c,
+            &spi_get_hw(SPI_PORT)->dr,  // SPI TX FIFO
+            dac_block[b],
+            SYNTH_CHANNELS * AUDIO_BLOCK_SIZE,
+            false
+        );
+        dma_channel_set_irq1_enabled(dac_chan[b], true);
+    }
+
+    // fill both blocks before the first transfer
+    synth_render_block(dac_block[0], AUDIO_BLOCK_SIZE);
+    synth_render_block(dac_block[1], AUDIO_BLOCK_SIZE);
+
+    // the ISR must land on core 1 so call this from core1_main
+    irq_set_exclusive_handler(DAC_DMA_IRQ, dac_dma_irq);
+    irq_set_enabled(DAC_DMA_IRQ, true);
+    dma_channel_start(dac_chan[0]);
 }
 
 static PT_THREAD(protothread_playsong(struct pt* pt))
 {
     PT_BEGIN(pt);
 
-        static int key1;
-        static int key2;
-        static int hold_time;
-        static int delay_tick = 1000; 
+        // events are decoded in place from the packed song in flash and
+        // timed on the synth's sample clock, so a slow thread here or a
+        // late wakeup does not push later notes back
+        static sequencer_t seq;
+        static uint32_t now;
 
 
-        static int i, j;
+        static int j;
 
         while(1) {
 
-            for (j = 0; j < NUM_SONGS; j++) {
+            for (j = 0; j < SONG_COUNT; j++) {
                 if (play_song[j]) { 
-                    set_chosen_song(j);
-                    for(i = 0; i < chosen_song_len; i++) {
-
-                        hold_time = chosen_song[i].hold_time;
-                        if (hold_time > 0) {
-                            PT_YIELD_usec(hold_time * delay_tick * song_speeds[j]);
-                        }
-
-                        key1 = chosen_song[i].notes_press - base_note;
-                        if (key1 >= 0 && key1 < NUM_KEYS) {
-                            prev_pressed[key1] = pressed[key1] = true;
-                            current_main_inc[key1] = main_inc[key1];
-                            current_mod_inc[key1] = mod_inc[key1];
-                            note_start[key1] = true;
-                            add_note(key1);
-                            //print_notes();
-                            //printf("Playing %d\n",key1);
-                        }
-                        key2 = chosen_song[i].notes_release - base_note;
-                        if (key2 >= 0 && key2 < NUM_KEYS) {
-                            pressed[key2] = prev_pressed[key2] = false;
-                        }
-
+                    song_playing = true;
+                    if (duet_setting == DUET_WITH_SONG) synth_set_pan_mode(PAN_DUET);
+                    seq_start(&seq, songs[j], note_time(), sample_rate, base_note);
+                    while (1) {
+                        now = note_time();
                         if (!play_song[j]) {
-                            // release all keys that could be pressed 
-                            for (int m = 0; m < BUFFER_COUNT; m++) {
-                                pressed[buffer[m]] = prev_pressed[buffer[m]] = false;
-                            }
-                            break;
+                            // release all keys that could be pressed, once
+                            // the song queue has room for it
+                            if (seq_stop(&seq, now)) break;
+                            PT_YIELD_usec(SEQ_PUMP_US);
+                            continue;
                         }
-                 
+                        if (!seq_pump(&seq, now, now + SEQ_LOOKAHEAD, sample_rate)) break;
+                        PT_YIELD_usec(SEQ_PUMP_US);
+                    }
+                    // let the last posted notes play before the next song
+                    while ((int32_t)(note_time() - seq.last) < 0) {
+                        PT_YIELD_usec(SEQ_PUMP_US);
                     }
+                    song_playing = false;
+                    if (duet_setting == DUET_WITH_SONG) synth_set_pan_mode(PAN_KEYS);
                 }
                 PT_YIELD_usec(10000);
             }
@@ -358,68 +615,53 @@ static PT_THREAD(protothread_buttonpress(struct pt* pt))
 {
     PT_BEGIN(pt);
     while(1) {
-        for (int i = 0; i < NUM_SONGS; i++) {
+        // each button toggles its song. When there are more songs than
+        // buttons, the last button plays its song, then each press moves
+        // on to the next song, and after the last one stops. The serial
+        // "song" command reaches any song as well.
+        static int i;
+        // song the last button is on, -1 for none
+        static int paged_song;
+        for (i = 0; i < NUM_SONG_BUTTONS && i < SONG_COUNT; i++) {
             if(!gpio_get(song_buttons[i])) {
-                play_song[i] = !play_song[i];
-                printf("Button %d pressed - value now %d", i, play_song[i]);
-                sleep_ms(250);
+                if (i == NUM_SONG_BUTTONS - 1 && SONG_COUNT > NUM_SONG_BUTTONS) {
+                    // taken from play_song[] each press, the serial "song"
+                    // command may have started or stopped one since: step
+                    // on from the first playing and stop the rest
+                    paged_song = -1;
+                    for (int j = SONG_COUNT - 1; j >= i; j--) {
+                        if (play_song[j]) paged_song = j;
+                        play_song[j] = false;
+                    }
+                    paged_song = (paged_song < 0) ? i : paged_song + 1;
+                    if (paged_song >= SONG_COUNT) paged_song = -1;
+                    else play_song[paged_song] = true;
+                    printf("Button %d pressed - song now %d", i, paged_song);
+                }
+                else {
+                    play_song[i] = !play_song[i];
+                    printf("Button %d pressed - value now %d", i, play_song[i]);
+                }
+                // debounce by yielding, sleep_ms() would stall every core 0 thread
+                PT_YIELD_usec(250000);
             } 
         }
-        //harp
-        if (!gpio_get(instrument_buttons[0])) {
-            menu[0].item_float_value = 3;// "Octave # ") ;
-            menu[1].item_float_value = .0;// "Attack main ") ;
-            menu[2].item_float_value = .0;// "Sustain main ") ;
-            menu[3].item_float_value = .5;// "Decay main ") ;  
-            menu[4].item_float_value = 2;// "Fmod/Fmain ") ;
-            menu[5].item_float_value = 2;// "FM depth max ") ;
-            menu[6].item_float_value = .0;// "Attack FM ") ;
-            menu[7].item_float_value = .0;// "Sustain FM ") ;
-            menu[8].item_float_value = .4;// "Decay FM ") ;
-            menu[9].item_float_value = 0;// "Lin=1/Quad DK ") ;
-            menu[10].item_float_value = 1;//  "Run ") ;
-        }
-        else if (!gpio_get(instrument_buttons[1])) {   
-            menu[0].item_float_value = 1 ;   //"Octave # ") ;
-            menu[1].item_float_value = 0.001 ;  //"Attack main ") ;
-            menu[2].item_float_value = 0 ;  //"Sustain main ") ;
-            menu[3].item_float_value = 0.99 ;   //"Decay main ") ;  
-            menu[4].item_float_value = 1.6 ;   //"Fmod/Fmain ") ;
-            menu[5].item_float_value = 1.5 ;  //"FM depth max ") ;
-            menu[6].item_float_value = 0.001 ;  //"Attack FM ") ;
-            menu[7].item_float_value = 0 ;   //"Sustain FM ") ;
-            menu[8].item_float_value = 0.90 ;   //"Decay FM ") ;
-            menu[9].item_float_value = 1 ;  //"Lin=1/Quad DK ") ;
-            menu[10].item_float_value = 1 ;  // "Run ") ;
-        }
-        else if (!gpio_get(instrument_buttons[2])) { 
-
-            menu[0].item_float_value = 3;// "Octave # ") ;
-            menu[1].item_float_value = .01;// "Attack main ") ;
-            menu[2].item_float_value = .0;// "Sustain main ") ;
-            menu[3].item_float_value = 3;// "Decay main ") ;  
-            menu[4].item_float_value = 3;// "Fmod/Fmain ") ;
-            menu[5].item_float_value = 0;// "FM depth max ") ;
-            menu[6].item_float_value = .01;// "Attack FM ") ;
-            menu[7].item_float_value = 0;// "Sustain FM ") ;
-            menu[8].item_float_value = 3;// "Decay FM ") ;
-            menu[9].item_float_value = 0;// "Lin=1/Quad DK ") ;
-            menu[10].item_float_value = 1;//  "Run ") ;
+        // harp, bells, sine, piano, see synth_presets
+        static int preset;
+        preset = -1;
+        for (int i = 0; i < NUM_INSTRUMENTS && i < NUM_PRESETS; i++) {
+            if (!gpio_get(instrument_buttons[i])) {
+                preset = i;
+                break;
+            }
         }
-        //piano
-        else if (!gpio_get(instrument_buttons[3])) {
-            menu[0].item_float_value = 3;// "Octave # ") ;
-            menu[1].item_float_value = .01;// "Attack main ") ;
-            menu[2].item_float_value = .3;// "Sustain main ") ;
-            menu[3].item_float_value = .5;// "Decay main ") ;  
-            menu[4].item_float_value = 3;// "Fmod/Fmain ") ;
-            menu[5].item_float_value = .25;// "FM depth max ") ;
-            menu[6].item_float_value = .01;// "Attack FM ") ;
-            menu[7].item_float_value = .1;// "Sustain FM ") ;
-            menu[8].item_float_value = .4;// "Decay FM ") ;
-            menu[9].item_float_value = 0;// "Lin=1/Quad DK ") ;
-            menu[10].item_float_value = 1;//  "Run ") ;
+        // the whole preset goes in as one menu write
+        menu_write_begin();
+        for (int i = 0; preset >= 0 && i < menu_length; i++) {
+            menu[i].item_float_value = synth_presets[preset][i];
         }
+        // an empty write still closes the sequence count
+        menu_write_end(preset >= 0 ? PARAM_ALL : 0);
 
 
         PT_YIELD_usec(10000);
@@ -476,11 +718,11 @@ static PT_THREAD(protothread_readmux(struct pt* pt))
         }
         if (pressed[key1] && !prev_pressed[key1]) {
             play_note[key1] = true;
-            current_main_inc[key1] = main_inc[key1];
-            current_mod_inc[key1] = mod_inc[key1];
-            note_start[key1] = true;
             printf("Adding %d\n", key1);
-            add_note(key1);
+            synth_post_note(NOTE_SRC_KEYS, key1, true, note_time());
+        }
+        else if (!pressed[key1] && prev_pressed[key1]) {
+            synth_post_note(NOTE_SRC_KEYS, key1, false, note_time());
         }
 
         // checking if key on mux 1 is pressed 
@@ -492,11 +734,11 @@ static PT_THREAD(protothread_readmux(struct pt* pt))
         }
         if (pressed[key2] && !prev_pressed[key2]) {
             play_note[key2] = true;
-            current_main_inc[key2] = main_inc[key2];
-            current_mod_inc[key2] = mod_inc[key2];
-            note_start[key2] = true;
             printf("Adding %d\n", key2);
-            add_note(key2);
+            synth_post_note(NOTE_SRC_KEYS, key2, true, note_time());
+        }
+        else if (!pressed[key2] && prev_pressed[key2]) {
+            synth_post_note(NOTE_SRC_KEYS, key2, false, note_time());
         }
 
         //COMMENT OUT TO TRY PRESSING THROUGH SERIAL INSTEAD
@@ -523,214 +765,68 @@ static PT_THREAD(protothread_readmux(struct pt* pt))
 static PT_THREAD(protothread_FM(struct pt* pt))
 {
     PT_BEGIN(pt);
-
-    // convert alarm period in uSEc to rate
-    Fs = 1.0 / ((float)alarm_period * 1e-6);
+    static unsigned int seen_version[NUM_PARAM_GROUPS];
+    static unsigned int dirty;
+    static unsigned int pass_start;
+    // menu values this pass works from, and the block being built
+    static float m[menu_length];
+    static synth_params_t *p;
     //
     while (1) {
 
         // == Fout and Fmod are in Hz
         // == fm_depth is 0 to 10 or so
         // == times are in seconds
-        // wait for the run command
-        PT_YIELD_UNTIL(pt, menu[10].item_float_value == 1);
+        // wait for the run command and for a parameter to change
+        PT_YIELD_UNTIL(pt, menu[10].item_float_value == 1 && (dirty = params_dirty(seen_version)));
+        // a copy taken mid write is retried on the next scheduler pass
+        PT_YIELD_UNTIL(pt, menu_snapshot(m));
+        // catch anything that landed while waiting, it is in the copy too
+        dirty |= params_dirty(seen_version);
+        synth_menu_clamp(m);
+        pass_start = PT_GET_TIME_usec();
+        // edit the spare block, the ISR keeps playing the live one
+        p = synth_params_edit();
+
+        // a new rate changes every increment and stage length
+        if (requested_rate != sample_rate) {
+            dac_set_rate(requested_rate);
+            dirty = PARAM_ALL;
+            printParams = true;
+        }
+        Fs = dac_fs;
 
-        // conversion to intrnal units
-        // increment = Fout/Fs * 2^32
+        // conversion to intrnal units, see synth_params.c
+        if (dirty & PARAM_PITCH) synth_build_pitch(p, m, sample_rate, Fs, use_pcm, base_note);
+        if (dirty & PARAM_AMP_ENV) synth_build_amp_env(p, m, Fs);
+        if (dirty & PARAM_MOD_ENV) synth_build_mod_env(p, m, Fs);
 
-        Fmod = menu[4].item_float_value;
+        // all groups go live together at the next block
+        synth_publish_params(p);
+
+        // core 1 time spent here, it used to be every pass of the scheduler
+        fm_busy_us += PT_GET_TIME_usec() - pass_start;
+        fm_passes++;
 
-        float current_note;
-        for (int i = 0; i < NUM_KEYS; i++) {
-            current_note = notes[i];
-            main_inc[i] = current_note * pow(2, 32) / Fs;
-            mod_inc[i] = Fmod * current_note * pow(2, 32) / Fs;
-        }
-        
-        // fm modulation strength
-        max_mod_depth = float_to_fix(menu[5].item_float_value * 100000);
-
-        // convert main input times to sample number
-        attack_time = float_to_fix(menu[1].item_float_value * Fs);
-        decay_time = float_to_fix(menu[3].item_float_value * Fs);
-        sustain_time = float_to_fix(menu[2].item_float_value * Fs);
-        // and now get increments
-        attack_inc = div(max_amp, attack_time);
-        // linear and parabolic fit
-        decay_inc = div(max_amp, decay_time);
-        recip_decay_time = div(onefix, decay_time);
-        //quad_decay_inc = mul((decay_inc<<1), recip_decay_time);
-        // this need to be floating point becuase of squareing the decay time
-        //f_quad_decay_inc = (fix_to_float(decay_inc<<1)/fix_to_float(decay_time));
-
-        // convert modulation input times to sample number
-        mod_attack_time = float_to_fix(menu[6].item_float_value * Fs);
-        mod_decay_time = float_to_fix(menu[8].item_float_value * Fs);
-        mod_sustain_time = float_to_fix(menu[7].item_float_value * Fs);
-        // and now get increments
-        // precomputing increments means that only add/subtract is needed
-        mod_attack_inc = div(max_mod_depth, mod_attack_time);
-        mod_decay_inc = div(max_mod_depth, mod_decay_time);
         if (printParams) {
             printParams = false;
             printf("--------------------------------------------\n"
                 "octave_num: %f\nFmod: %f\nattack_time: %f\ndecay_time: %f\n"
                 "sustain_time: %f\nattack_inc: %f\ndecay_inc: %f\nmod_attack_time: %f\n"
                 "mod_decay_time: %f\nmod_sustain_time: %f\nmod_depth: %f\n",
-                (octave_num), (Fmod), menu[1].item_int_value, menu[3].item_int_value,
-                menu[2].item_int_value, fix_to_float(attack_inc), fix_to_float(decay_inc), menu[6].item_int_value,
-                menu[8].item_int_value, menu[7].item_int_value, fix_to_float(max_mod_depth));
+                (octave_num), m[4], menu[1].item_int_value, menu[3].item_int_value,
+                menu[2].item_int_value, fix_to_float(p->amp.attack_inc), fix_to_float(p->amp.decay_inc), menu[6].item_int_value,
+                menu[8].item_int_value, menu[7].item_int_value, m[5] * 100000);
+            printf("FM recompute: %u passes, %u uSec total since boot\n", fm_passes, fm_busy_us);
+            print_rate_budget();
+            print_sample_clock();
         }
-        // tell the synth ISR to go
-        static int i, j;
-
 
       // NEVER exit while
     } // END WHILE(1)
     PT_END(pt);
 } // timer thread
 
-// ==================================================
-// === ISR routine -- RUNNING on core 1
-// ==================================================
-// 
-void compute_sample(void)
-{
-    // === 
-    static int i;
-    for (int j = 0; j < BUFFER_COUNT; j++) {
-        // start a burst on new data
-        i = buffer[j]; 
-        //i = j;
-        if (i != -1) {
-        if (note_start[i]) {
-            // reset the start flag
-            note_start[i] = false;
-            // init the amplitude
-            current_amp[i] = attack_inc;
-            current_mod_depth[i] = mod_attack_inc;
-            // reset envelope time
-            note_time[i] = 0;
-            // phase lock the main frequency
-            main_accum[i] = 0;
-            add_delay[i] = 0;
-        } // note start
-        else if (pressed[i] && prev_pressed[i]) {
-            add_delay[i] += onefix;
-        }
-        // play the burst as long as the amplitude is positive
-        // as it decays linearly
-        if (current_amp[i] > 0) {
-
-            // update dds modulation freq
-            mod_accum[i] += current_mod_inc[i];
-            mod_wave[i] = sine_table[mod_accum[i] >> 24];
-            // get the instataneous modulation amp 
-            // update modulation amplitude envelope 
-            // printf("mod attack time is %f\n", fix_to_float(mod_attack_time));
-            if (note_time[i] < (mod_attack_time + mod_decay_time + mod_sustain_time + add_delay[i])) {
-                current_mod_depth[i] = (note_time[i] <= mod_attack_time) ?
-                    current_mod_depth[i] + mod_attack_inc :
-                    (note_time[i] <= mod_attack_time + mod_sustain_time + add_delay[i]) ? current_mod_depth[i] :
-                    current_mod_depth[i] - mod_decay_inc;
-            }
-            else {
-                current_mod_depth[i] = 0;
-            }
-
-            // set dds main freq and FM modulate it
-            main_accum[i] += current_main_inc[i] + (unsigned int)mul(mod_wave[i], current_mod_depth[i]);
-            // update main waveform
-            main_wave[i] = sine_table[main_accum[i] >> 24];
-
-            // get the instataneous amp 
-            // update amplitude envelope 
-            // linear EXCEPT for optional parabolic decay
-            if (note_time[i] < (attack_time + decay_time + sustain_time + add_delay[i])) {
-                if (note_time[i] <= attack_time) current_amp[i] += attack_inc;
-                else if (note_time[i] > attack_time + sustain_time + add_delay[i]) {
-                    if (linear_dk == 1) { current_amp[i] -= decay_inc; }
-                    else {
-                        current_amp[i] = current_amp[i] - (decay_inc << 1) +
-                            div(mul((decay_inc << 1), (note_time[i] - attack_time - sustain_time - add_delay[i])), decay_time);
-                    }
-                }
-            }
-            else {
-                current_amp[i] = 0;
-            }
-            // amplitide modulate and shift to the correct range for PWM
-            main_wave[i] = mul(main_wave[i], current_amp[i]);
-
-            // move time ahead
-            note_time[i] += onefix;
-        }
-        }
-
-    }
-
-    fix sum_waves = int_to_fix(0);
-
-    for (int i = 0; i < BUFFER_COUNT; i++) {
-        int j = buffer[i];
-        if (j != -1) {
-            sum_waves += main_wave[j];
-        }
-    }
-
-    fix final_wave = div(sum_waves, int_to_fix(BUFFER_COUNT));
-    //printf("final wave = %d\n", fix_to_int(final_wave));
-
-    DAC_data = (DAC_config_chan_A | ((fix_to_int(final_wave) + 2048) & 0xfff));
-
-    // Write data to DAC
-    spi_write16_blocking(SPI_PORT, &DAC_data, 1);
-
-} // end ISR call
-
-void add_note(int note) {
-    // either the note is already present in buffer, or it is not present 
-
-    // look for index if it is present. 
-    int index = -1;
-    for (int i = 0; i < BUFFER_COUNT; i++) {
-        if (buffer[i] == note) {
-            index = i;
-        }
-    }
-    // if not found, remove the first element of buffer and then add new note to 
-    // end. 
-    int next;
-    if (index == -1) {
-        
-        for (int j = 0; j < BUFFER_COUNT-1; j++) {
-            next = buffer[j+1]; 
-            buffer[j] = next;
-        }
-        // note is now at end of buffer, most recently played. 
-        buffer[BUFFER_COUNT - 1] = note;
-    }
-    // if found, shift notes so that the note is now at end of buffer 
-    // do not need to remove any elements of buffer since there 
-    // is already space allocated for note. 
-    else {
-        for (int k = index; k < BUFFER_COUNT-1; k++) {
-            next = buffer[k+1]; 
-            buffer[k] = next; 
-        }
-        buffer[BUFFER_COUNT - 1] = note;
-    }
-}
-
-// debugging buffer logic
-void print_notes(void) {
-    printf("buffer :");
-    for (int i = 0; i < BUFFER_COUNT; i++) {
-        printf("%d, ", buffer[i]);
-    }
-    printf("\n");
-}
-
 // User input thread. 
 static PT_THREAD(protothread_serial(struct pt* pt))
 {
@@ -786,14 +882,75 @@ static PT_THREAD(protothread_serial(struct pt* pt))
             else if (!strcmp(user_input_string, "moddepth")) {
                 change_value_serial(5, float_in);
             }
+            else if (!strcmp(user_input_string, "osc")) {
+                // 0 = 256 entry table, 1 = interpolated quarter wave; the
+                // boot default is the SYNTH_OSCILLATOR cmake setting
+                synth_set_oscillator((int)float_in);
+            }
+            else if (!strcmp(user_input_string, "rate")) {
+                // output rate in Hz, one of rate_choices
+                for (int r = 0; r < NUM_RATE_CHOICES; r++) {
+                    if (rate_choices[r] == (int)float_in) {
+                        requested_rate = rate_choices[r];
+                        // protothread_FM switches the DAC and rebuilds everything
+                        mark_params_dirty(PARAM_ALL);
+                    }
+                }
+            }
+            else if (!strcmp(user_input_string, "load")) {
+                // cost model and measured render time at this rate
+                print_rate_budget();
+            }
+            else if (!strcmp(user_input_string, "clock")) {
+                // measured sample period and its spread
+                print_sample_clock();
+            }
+            else if (!strcmp(user_input_string, "duet")) {
+                // 1 = song on the left and keys on the right, 0 = spread by
+                // key, 2 = the duet only while a song plays (boot default)
+                if ((int)float_in >= DUET_OFF && (int)float_in <= DUET_WITH_SONG) {
+                    duet_setting = (int)float_in;
+                    synth_set_pan_mode(duet_setting == DUET_ON || (duet_setting == DUET_WITH_SONG && song_playing) ?
+                        PAN_DUET : PAN_KEYS);
+                }
+            }
+            else if (!strcmp(user_input_string, "pcm")) {
+                // 1 = sample playback for new notes, 0 = FM; then stats
+                use_pcm = (float_in != 0);
+                mark_params_dirty(PARAM_PITCH);
+                print_pcm_stats();
+            }
+            else if (!strcmp(user_input_string, "song")) {
+                // start or stop any song, numbered from 0 in songs/ order
+                if ((int)float_in >= 0 && (int)float_in < SONG_COUNT) {
+                    play_song[(int)float_in] = !play_song[(int)float_in];
+                }
+            }
+            else if (!strcmp(user_input_string, "dual")) {
+                // 1 = split voices across both cores, 0 = core 1 only
+                synth_set_dual(float_in != 0);
+            }
+            else if (!strcmp(user_input_string, "voices")) {
+                synth_set_polyphony((int)float_in);
+                sprintf(pt_serial_out_buffer, "polyphony %d, budget allows %d\n\r",
+                    polyphony, voice_limit);
+                serial_write;
+                // note queue high water marks and losses
+                for (int q = 0; q < NUM_NOTE_SOURCES; q++) {
+                    sprintf(pt_serial_out_buffer, "queue %d: max depth %u, dropped %u, late %u\n\r",
+                        q, note_queues[q].max_depth, note_queues[q].dropped, note_queues[q].late);
+                    serial_write;
+                }
+            }
             else if (!strcmp(user_input_string, "scale")) {
-                int tn;
+                // kept across the yields
+                static int tn;
                 for (tn = 0; tn < NUM_KEYS; tn++) {
                     sprintf(pt_serial_out_buffer, "playing note %d", tn);
                     serial_write;
-                    current_main_inc[tn] = main_inc[tn];
-                    current_mod_inc[tn] = mod_inc[tn];
-                    note_start[tn] = true;
+                    // serial shares core 0 with readmux, so it shares its queue
+                    synth_post_note(NOTE_SRC_KEYS, tn, true, note_time());
+                    synth_post_note(NOTE_SRC_KEYS, tn, false, note_time());
                     PT_YIELD_usec(1000000);
 
                     // PT_YIELD_UNTIL(pt, current_amp[i-1]<onefix);
@@ -829,8 +986,8 @@ static PT_THREAD(protothread_serial(struct pt* pt))
 // ========================================
 void core1_main() {
 
-    // fire off interrupt
-    alarm_in_us(alarm_period);
+    // start streaming to the DAC
+    dac_dma_init();
 
     //  === add threads  ====================
     // for core 1
@@ -853,38 +1010,19 @@ int main() {
     // set the clock
     //set_sys_clock_khz(250000, true); // 171us
 
-    for (int i = 0; i < NUM_KEYS; i++) {
-        current_amp[i] = float_to_fix(2000.0);
-    }
+    synth_init();
 
     for (int i = 0; i < NUM_KEYS; i++) {
-        note_start[i] = true;
         play_note[i] = false; // no keys pressed initially
     }
 
-    for (int i = 0; i < NUM_SONGS; i++) {
+    for (int i = 0; i < SONG_COUNT; i++) {
         play_song[i] = false; // no songs to be played initially
     }
 
-    for (int i = 0; i < BUFFER_COUNT; i++) {
-        buffer[i] = -1; // no keys pressed initially
-    }
-
-    for (int i = 0; i < NUM_KEYS; i++) {
-        notes[i] = 440.0 * pow(2, (base_note+i-69.0)/12.0);
-    }
 
-
-    // dds table 10 bit values
-    int i = 0;
-    while (i < 256) {
-        // sine table is in naural +1/-1 range
-        sine_table[i] = float_to_fix(sin(2 * 3.1416 * i / 256));
-        i++;
-    }
-
-    // start the serial i/o
-    // stdio_init_all();
+    // start the serial i/o, the console on uart0 (GPIO 0 and 1)
+    stdio_init_all();
     // announce the threader version on system reset
     printf("\n\rProtothreads RP2040 v1.11 two-core\n\r");
 
@@ -914,7 +1052,7 @@ int main() {
     gpio_put(MUX_SEL_C, 0);
     gpio_put(MUX_SEL_D, 0);
 
-    for(int i = 0; i < NUM_SONGS; i++) {
+    for(int i = 0; i < NUM_SONG_BUTTONS; i++) {
         gpio_init(song_buttons[i]);
         gpio_set_dir(song_buttons[i], GPIO_IN);
         gpio_pull_up(song_buttons[i]);
@@ -976,35 +1114,27 @@ int main() {
     menu[10].item_increment = 1;  // "Run ") ;
 
     // piano configuration
-    menu[0].item_float_value = 3;// "Octave # ") ;
-    menu[1].item_float_value = .01;// "Attack main ") ;
-    menu[2].item_float_value = .3;// "Sustain main ") ;
-    menu[3].item_float_value = .5;// "Decay main ") ;  
-    menu[4].item_float_value = 3;// "Fmod/Fmain ") ;
-    menu[5].item_float_value = .25;// "FM depth max ") ;
-    menu[6].item_float_value = .01;// "Attack FM ") ;
-    menu[7].item_float_value = .1;// "Sustain FM ") ;
-    menu[8].item_float_value = .4;// "Decay FM ") ;
-    menu[9].item_float_value = 0;// "Lin=1/Quad DK ") ;
-    menu[10].item_float_value = 1;//  "Run ") ;
+    for (int i = 0; i < menu_length; i++) {
+        menu[i].item_float_value = synth_presets[PRESET_PIANO][i];
+    }
 
     menu[0].item_float_min = 1;
     menu[0].item_float_max = 6;
-    menu[1].item_float_min = .001;
+    menu[1].item_float_min = SYNTH_MIN_TIME;
     menu[1].item_float_max = 5;
     menu[2].item_float_min = .001;
     menu[2].item_float_max = 5;
-    menu[3].item_float_min = .001;
+    menu[3].item_float_min = SYNTH_MIN_TIME;
     menu[3].item_float_max = 5;
     menu[4].item_float_min = .001;
     menu[4].item_float_max = 100;
     menu[5].item_float_min = .001;
     menu[5].item_float_max = 100;
-    menu[6].item_float_min = .001;
+    menu[6].item_float_min = SYNTH_MIN_TIME;
     menu[6].item_float_max = 5;
     menu[7].item_float_min = .001;
     menu[7].item_float_max = 5;
-    menu[8].item_float_min = .001;
+    menu[8].item_float_min = SYNTH_MIN_TIME;
     menu[8].item_float_max = 5;
     menu[9].item_float_min = 0;
     menu[9].item_float_max = 1;
@@ -1017,13 +1147,15 @@ int main() {
     // start core 1 threads
     multicore_reset_core1();
     multicore_launch_core1(&core1_main);
+    // core 0 renders half the voices from here on
+    render_helper_init();
 
     // === config threads ========================
     // for core 0
 
     pt_add_thread(protothread_readmux);
     pt_add_thread(protothread_buttonpress);
-    // pt_add_thread(protothread_serial);
+    pt_add_thread(protothread_serial);
     pt_add_thread(protothread_playsong);
     //
     // === initalize the scheduler ===============
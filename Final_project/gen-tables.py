@@ -0,0 +1,209 @@
+"""
+Generates the synth lookup tables at build time.
+args: output directory, optionally the sample rates in Hz
+eg. python <script-path> <out-dir> 27778 32000 44100 48000
+
+Writes synth_tables.h and synth_tables.c containing
+sine_table: one DDS cycle, 256 entries of s19x12
+sine_quarter: first quarter cycle plus the end point, s1x15, for the
+interpolating oscillator
+notes: key frequencies in Hz, equal tempered from base_note
+note_inc_table: main DDS increment of each key at each sample rate
+mix_gain: mixer gain for each count of sounding voices, Q10
+soft_clip: saturating curve above SOFT_CLIP_KNEE for the DAC output, with
+the end point so interpolation needs no bounds check
+pcm_zones: looped 16 bit multisamples for the sample-playback voice, one
+zone per root note, synthesized here as there are no recordings to ship
+
+The values repeat the arithmetic main() and protothread_FM used to do at
+boot, including the float roundings, so they are bit-for-bit the same
+for the nominal rate. The DMA timer may run a few ppm off it.
+"""
+
+import os
+import struct
+import sys
+import math
+
+NUM_KEYS = 50
+BASE_NOTE = 36
+# quarter wave entries, 2^8 points is 1024 per cycle
+SINE_QUARTER_BITS = 8
+# mix_gain covers 0..MIX_MAX_VOICES sounding voices
+MIX_MAX_VOICES = 32
+# highest level of one voice in DAC units: max_amp, 1000, plus the last
+# attack step, 36 at the shortest attack the menu allows
+VOICE_PEAK = 1050
+# soft clipper: linear up to the knee, then SOFT_CLIP_LEN steps of
+# 2^SOFT_CLIP_SHIFT easing into full scale, interpolated in between
+DAC_FULL_SCALE = 2047
+SOFT_CLIP_KNEE = 1536
+SOFT_CLIP_SHIFT = 4
+SOFT_CLIP_LEN = 256
+# PCM multisamples: roots as MIDI notes, the rate they are stored at, the
+# unlooped attack and roughly how long the loop is
+PCM_ROOTS = [48, 60, 72]
+PCM_RATE = 27778
+PCM_ATTACK = 0.2
+PCM_LOOP = 2048
+
+
+def f32(x):
+    # round a double to the nearest float, as a C float assignment does
+    return struct.unpack('f', struct.pack('f', x))[0]
+
+
+def c_float(x):
+    # shortest decimal that reads back as the same float
+    for digits in range(6, 10):
+        s = '%.*g' % (digits, x)
+        if f32(float(s)) == x:
+            break
+    if '.' not in s and 'e' not in s:
+        s += '.0'
+    return s + 'f'
+
+
+out_dir = sys.argv[1]
+rates = [int(r) for r in sys.argv[2:]] or [27778]
+
+# sine table is in naural +1/-1 range
+# float_to_fix(sin(2 * 3.1416 * i / 256)), truncated toward 0
+sine = [int(math.sin(2 * 3.1416 * i / 256) * 4096.0) for i in range(256)]
+
+# quarter wave, rounded, with the end point so interpolation needs no wrap
+quarter = [int(round(math.sin(math.pi / 2 * i / (1 << SINE_QUARTER_BITS)) * 32767))
+           for i in range((1 << SINE_QUARTER_BITS) + 1)]
+
+# 440.0 * pow(2, (base_note+i-69.0)/12.0) stored as float
+notes = [f32(440.0 * math.pow(2, (BASE_NOTE + i - 69.0) / 12.0)) for i in range(NUM_KEYS)]
+
+# one voice at its peak just reaches the knee, so a solo note is never
+# clipped; n voices add up roughly as sqrt(n)
+mix_gain = [int(1024 * SOFT_CLIP_KNEE / VOICE_PEAK / math.sqrt(max(n, 1)))
+            for n in range(MIX_MAX_VOICES + 1)]
+
+# tanh knee, continuous in value and slope with the linear part
+span = DAC_FULL_SCALE - SOFT_CLIP_KNEE
+soft_clip = [int(round(SOFT_CLIP_KNEE + span * math.tanh((i << SOFT_CLIP_SHIFT) / span)))
+             for i in range(SOFT_CLIP_LEN + 1)]
+
+def pcm_zone(root):
+    """Struck-string tone: decaying inharmonic partials and a hammer
+    thump over the attack, settling into a purely harmonic tone that
+    loops over a whole number of cycles."""
+    f0 = 440.0 * math.pow(2, (root - 69) / 12.0)
+    loop_start = int(PCM_ATTACK * PCM_RATE)
+    cycles = max(1, int(round(PCM_LOOP * f0 / PCM_RATE)))
+    loop_len = int(round(cycles * PCM_RATE / f0))
+    # the loop is exactly cycles periods, so that is the true root
+    f0 = cycles * PCM_RATE / loop_len
+    harmonics = [h for h in range(1, 9) if h * f0 < PCM_RATE / 2.5]
+    seed = root
+    data = []
+    for n in range(loop_start + loop_len):
+        # 1 -> 0 over the attack, exactly 0 from the loop on
+        w = max(0.0, 1.0 - n / loop_start) ** 2
+        t = n / PCM_RATE
+        x = 0.0
+        for h in harmonics:
+            # steady part: whole harmonics, loops seamlessly
+            x += math.sin(2 * math.pi * h * f0 * t) / h ** 1.5 * (0.55 + 0.45 * w)
+            # stretched partials only while the attack lasts
+            x += 0.3 * w * math.sin(2 * math.pi * h * f0 * 1.0015 ** (h * h) * t) / h
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        x += 0.4 * w ** 8 * ((seed >> 16) / 16384.0 - 1.0)
+        data.append(x)
+    peak = max(abs(x) for x in data)
+    data = [int(round(x * 32000 / peak)) for x in data]
+    # guard frame so interpolation never reads past the loop
+    data.append(data[loop_start])
+    return f0, loop_start, loop_start + loop_len, data
+
+
+pcm = [pcm_zone(root) for root in PCM_ROOTS]
+
+def rate_fs(rate):
+    """Fs as a float. A rate that rounds from a whole number of
+    microseconds is that period, as Fs = 1.0 / ((float)alarm_period *
+    1e-6) had it, so 27778 is the old 36 uSec rate, 27777.78 Hz."""
+    period = round(1e6 / rate)
+    if round(1e6 / period) == rate:
+        return f32(1.0 / (f32(period) * 1e-6))
+    return f32(float(rate))
+
+
+incs = []
+for rate in rates:
+    fs = rate_fs(rate)
+    # main_inc = current_note * pow(2, 32) / Fs, truncated to unsigned int
+    incs.append([int(n * math.pow(2, 32) / fs) for n in notes])
+
+with open(os.path.join(out_dir, 'synth_tables.h'), 'w') as f:
+    f.write('// generated by gen-tables.py -- do not edit\n')
+    f.write('#ifndef SYNTH_TABLES_H\n#define SYNTH_TABLES_H\n\n')
+    f.write('#define SYNTH_TABLE_KEYS %d\n' % NUM_KEYS)
+    f.write('#define SYNTH_TABLE_BASE_NOTE %d\n' % BASE_NOTE)
+    f.write('#define SYNTH_NUM_RATES %d\n' % len(rates))
+    f.write('#define SINE_QUARTER_BITS %d\n' % SINE_QUARTER_BITS)
+    f.write('#define MIX_MAX_VOICES %d\n' % MIX_MAX_VOICES)
+    f.write('#define SOFT_CLIP_KNEE %d\n' % SOFT_CLIP_KNEE)
+    f.write('#define SOFT_CLIP_SHIFT %d\n' % SOFT_CLIP_SHIFT)
+    f.write('#define SOFT_CLIP_LEN %d\n' % SOFT_CLIP_LEN)
+    f.write('#define PCM_NUM_ZONES %d\n\n' % len(pcm))
+    f.write('// sample rates in Hz that note_inc_table covers\n')
+    f.write('extern const int sample_rates[SYNTH_NUM_RATES];\n')
+    f.write('extern const fix sine_table[256];\n')
+    f.write('extern const short sine_quarter[(1 << SINE_QUARTER_BITS) + 1];\n')
+    f.write('extern const float notes[SYNTH_TABLE_KEYS];\n')
+    f.write('extern const unsigned int note_inc_table[SYNTH_NUM_RATES][SYNTH_TABLE_KEYS];\n')
+    f.write('extern const short mix_gain[MIX_MAX_VOICES + 1];\n')
+    f.write('extern const short soft_clip[SOFT_CLIP_LEN + 1];\n')
+    f.write('extern const pcm_zone_t pcm_zones[PCM_NUM_ZONES];\n')
+    f.write('\n#endif\n')
+
+with open(os.path.join(out_dir, 'synth_tables.c'), 'w') as f:
+    f.write('// generated by gen-tables.py -- do not edit\n')
+    f.write('#include "synth.h"\n\n')
+    f.write('const int sample_rates[SYNTH_NUM_RATES] = {%s};\n\n'
+            % ', '.join(str(r) for r in rates))
+    f.write('// read by the synthesis ISR on every sample\n')
+    f.write('const fix SYNTH_HOT_DATA(sine_table)[256] = {\n')
+    for i in range(0, 256, 8):
+        f.write('    ' + ', '.join('%d' % v for v in sine[i:i + 8]) + ',\n')
+    f.write('};\n\n')
+    f.write('const short SYNTH_HOT_DATA(sine_quarter)[(1 << SINE_QUARTER_BITS) + 1] = {\n')
+    for i in range(0, len(quarter), 8):
+        f.write('    ' + ', '.join('%d' % v for v in quarter[i:i + 8]) + ',\n')
+    f.write('};\n\n')
+    f.write('const float notes[SYNTH_TABLE_KEYS] = {\n')
+    for i in range(0, NUM_KEYS, 5):
+        f.write('    ' + ', '.join(c_float(v) for v in notes[i:i + 5]) + ',\n')
+    f.write('};\n\n')
+    f.write('const unsigned int note_inc_table[SYNTH_NUM_RATES][SYNTH_TABLE_KEYS] = {\n')
+    for rate, row in zip(rates, incs):
+        f.write('    { // %d Hz\n' % rate)
+        for i in range(0, NUM_KEYS, 5):
+            f.write('        ' + ', '.join('%du' % v for v in row[i:i + 5]) + ',\n')
+        f.write('    },\n')
+    f.write('};\n\n')
+    f.write('const short mix_gain[MIX_MAX_VOICES + 1] = {\n')
+    for i in range(0, len(mix_gain), 8):
+        f.write('    ' + ', '.join('%d' % v for v in mix_gain[i:i + 8]) + ',\n')
+    f.write('};\n\n')
+    # only read above the knee, main SRAM; scratch X is full, see synth.h
+    f.write('const short SYNTH_RAM_DATA(soft_clip)[SOFT_CLIP_LEN + 1] = {\n')
+    for i in range(0, SOFT_CLIP_LEN + 1, 8):
+        f.write('    ' + ', '.join('%d' % v for v in soft_clip[i:i + 8]) + ',\n')
+    f.write('};\n\n')
+    # left in flash and read through XIP, front to back
+    for root, (f0, loop_start, loop_end, data) in zip(PCM_ROOTS, pcm):
+        f.write('static const short pcm_data_%d[%d] = {\n' % (root, len(data)))
+        for i in range(0, len(data), 12):
+            f.write('    ' + ', '.join('%d' % v for v in data[i:i + 12]) + ',\n')
+        f.write('};\n\n')
+    f.write('const pcm_zone_t pcm_zones[PCM_NUM_ZONES] = {\n')
+    for root, (f0, loop_start, loop_end, data) in zip(PCM_ROOTS, pcm):
+        f.write('    { pcm_data_%d, %d, %d, %s, %d, %d },\n'
+                % (root, loop_start, loop_end, c_float(f32(f0)), PCM_RATE, root))
+    f.write('};\n')
@@ -0,0 +1,69 @@
+// song sequencer, see sequencer.h
+#include "sequencer.h"
+
+uint32_t seq_sample(const sequencer_t *s, uint64_t us) {
+    // after a rate change an event still waiting can be due before
+    // start_us, so the offset is signed, rounded half away from 0
+    int64_t d = (int64_t)(us - s->start_us) * s->rate;
+    return s->start + (uint32_t)(int32_t)((d + (d < 0 ? -500000 : 500000)) / 1000000);
+}
+
+void seq_start(sequencer_t *s, const song_t *song, uint32_t now, int rate, int base_note) {
+    s->song = song;
+    song_open(song, &s->reader);
+    s->has_next = false;
+    s->next_us = 0;
+    s->start = now;
+    s->start_us = 0;
+    s->rate = rate;
+    s->base_note = base_note;
+    s->last = now;
+    s->playing = true;
+}
+
+bool seq_pump(sequencer_t *s, uint32_t now, uint32_t horizon, int rate) {
+    note_queue_t *q = &note_queues[NOTE_SRC_SONG];
+
+    if (!s->playing) return false;
+    if (rate != s->rate) {
+        // the song is at the same place at now, the rest runs at the new rate
+        s->start_us += (uint64_t)(now - s->start) * 1000000 / s->rate;
+        s->start = now;
+        s->rate = rate;
+    }
+
+    while (1) {
+        if (!s->has_next) {
+            if (!song_next(&s->reader, &s->next)) {
+                s->playing = false;
+                return false;
+            }
+            s->next_us += (uint64_t)s->next.delta * s->song->tick_us;
+            s->has_next = true;
+        }
+        uint32_t at = seq_sample(s, s->next_us);
+        if ((int32_t)(at - horizon) >= 0) return true;
+        int key = s->next.note - s->base_note;
+        if (key >= 0 && key < NUM_KEYS) {
+            // full: leave it for the next call rather than drop it
+            if (q->head - q->tail >= NOTE_QUEUE_SIZE) return true;
+            synth_post_note(NOTE_SRC_SONG, key, s->next.on, at);
+            s->last = at;
+        }
+        s->has_next = false;
+    }
+}
+
+bool seq_stop(sequencer_t *s, uint32_t now) {
+    note_queue_t *q = &note_queues[NOTE_SRC_SONG];
+
+    // full: a dropped all-off would leave every song voice held, so
+    // leave it for the next call as seq_pump does
+    if (q->head - q->tail >= NOTE_QUEUE_SIZE) return false;
+    // behind the events already posted, which are in time order. Only
+    // voices the song struck are released, keys the player holds stay
+    uint32_t at = (int32_t)(s->last - now) > 0 ? s->last : now;
+    synth_post_note(NOTE_SRC_SONG, NOTE_ALL_OFF, false, at);
+    s->playing = false;
+    return true;
+}
@@ -0,0 +1,54 @@
+/**
+ * Song sequencer
+ *
+ * Plays a packed song (song.h) against the synth's sample clock. Every
+ * event gets an absolute sample, start + its song time at the output
+ * rate, and is posted to the NOTE_SRC_SONG queue a little ahead of time;
+ * the DMA ISR applies it at exactly that sample. A late call to
+ * seq_pump() therefore never moves later notes, and the tempo cannot
+ * drift however the calling thread is scheduled.
+ *
+ * Like synth.c this touches no hardware, so it runs on the host too.
+ */
+
+#ifndef SEQUENCER_H
+#define SEQUENCER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "song.h"
+#include "synth.h"
+
+// how far ahead of the render position events are posted, in samples.
+// Must cover the gap between seq_pump() calls, and the events it spans
+// must fit in NOTE_QUEUE_SIZE; it is also the latency of a stop.
+#define SEQ_LOOKAHEAD (4 * AUDIO_BLOCK_SIZE)
+
+typedef struct sequencer {
+    const song_t *song;
+    song_reader_t reader;
+    song_event_t next;      // decoded, not yet posted
+    bool has_next;
+    uint64_t next_us;       // song time of next
+    uint32_t start;         // sample the song time is counted from
+    uint64_t start_us;      // song time at start
+    int rate;               // output rate start was worked out for
+    int base_note;          // MIDI note of key 0
+    uint32_t last;          // sample of the last posted event
+    bool playing;
+} sequencer_t;
+
+// play song from sample now at rate
+void seq_start(sequencer_t *s, const song_t *song, uint32_t now, int rate, int base_note);
+// post every event due before sample horizon, as far as the queue has
+// room. rate is the current output rate; a change re-times the rest of
+// the song from now. Returns false once the whole song is posted
+bool seq_pump(sequencer_t *s, uint32_t now, uint32_t horizon, int rate);
+// stop and release every voice the song struck once the events already
+// posted have played; keys the player holds keep sounding. Returns false,
+// still playing, while the song queue has no room; call again later
+bool seq_stop(sequencer_t *s, uint32_t now);
+// sample the event at song time us lands on
+uint32_t seq_sample(const sequencer_t *s, uint64_t us);
+
+#endif
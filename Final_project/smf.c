@@ -0,0 +1,204 @@
+// Standard MIDI File reader, see smf.h
+#include "smf.h"
+
+static uint32_t be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint16_t be16(const uint8_t *p) {
+    return (p[0] << 8) | p[1];
+}
+
+// variable length quantity, at most 4 bytes in a well formed file
+static bool read_varint(const uint8_t **pos, const uint8_t *end, uint32_t *v) {
+    const uint8_t *p = *pos;
+    uint32_t x = 0;
+    for (int i = 0; i < 4; i++) {
+        if (p >= end) return false;
+        uint8_t b = *p++;
+        x = (x << 7) | (b & 0x7f);
+        if (!(b & 0x80)) {
+            *v = x;
+            *pos = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+// reads the delta time of the next event, or marks the track done when
+// it ends without an end of track meta event
+static bool track_advance(smf_t *smf, smf_track_t *t) {
+    uint32_t delta;
+    if (t->pos >= t->end) {
+        t->done = true;
+        return true;
+    }
+    if (!read_varint(&t->pos, t->end, &delta)) {
+        smf->error = SMF_ERR_TRUNCATED;
+        return false;
+    }
+    t->tick += delta;
+    return true;
+}
+
+int smf_open(smf_t *smf, const uint8_t *data, size_t size) {
+    const uint8_t *end = data + size;
+    const uint8_t *p;
+    uint32_t len;
+    int declared;
+
+    smf->error = SMF_OK;
+    smf->num_tracks = 0;
+    smf->tempo = SMF_DEFAULT_TEMPO;
+    smf->tempo_tick = 0;
+    smf->tempo_us = 0;
+
+    if (size < 14 || data[0] != 'M' || data[1] != 'T' || data[2] != 'h' || data[3] != 'd')
+        return smf->error = SMF_ERR_HEADER;
+    len = be32(data + 4);
+    if (len < 6) return smf->error = SMF_ERR_HEADER;
+    if (len > size - 8) return smf->error = SMF_ERR_TRUNCATED;
+    smf->format = be16(data + 8);
+    declared = be16(data + 10);
+    smf->division = be16(data + 12);
+    if (smf->format > 1 || (smf->format == 0 && declared != 1))
+        return smf->error = SMF_ERR_FORMAT;
+    if (declared > SMF_MAX_TRACKS) return smf->error = SMF_ERR_TRACKS;
+    if (smf->division & 0x8000) {
+        // SMPTE: frames per second, negated, and ticks per frame
+        if ((-(int8_t)(smf->division >> 8)) <= 0 || (smf->division & 0xff) == 0)
+            return smf->error = SMF_ERR_HEADER;
+    } else if (smf->division == 0) {
+        return smf->error = SMF_ERR_HEADER;
+    }
+
+    // tracks are the MTrk chunks in file order, anything else is skipped
+    p = data + 8 + len;
+    while (smf->num_tracks < declared && end - p >= 8) {
+        len = be32(p + 4);
+        if (len > (size_t)(end - p) - 8) return smf->error = SMF_ERR_TRUNCATED;
+        if (p[0] == 'M' && p[1] == 'T' && p[2] == 'r' && p[3] == 'k') {
+            smf_track_t *t = &smf->tracks[smf->num_tracks++];
+            t->pos = p + 8;
+            t->end = p + 8 + len;
+            t->tick = 0;
+            t->status = 0;
+            t->done = false;
+            if (!track_advance(smf, t)) return smf->error;
+        }
+        p += 8 + len;
+    }
+    return SMF_OK;
+}
+
+uint64_t smf_tick_us(const smf_t *smf, uint32_t tick) {
+    if (smf->division & 0x8000) {
+        uint32_t fps = -(int8_t)(smf->division >> 8);
+        return (uint64_t)tick * 1000000 / (fps * (smf->division & 0xff));
+    }
+    return smf->tempo_us + (uint64_t)(tick - smf->tempo_tick) * smf->tempo / smf->division;
+}
+
+bool smf_next(smf_t *smf, smf_event_t *e) {
+    while (smf->error == SMF_OK) {
+        smf_track_t *t = 0;
+        const uint8_t *p;
+        uint8_t status;
+        uint32_t len;
+        bool emit = false;
+
+        // earliest pending event, the lowest track wins a tie
+        for (int i = 0; i < smf->num_tracks; i++) {
+            smf_track_t *c = &smf->tracks[i];
+            if (!c->done && (!t || c->tick < t->tick)) t = c;
+        }
+        if (!t) return false;
+
+        p = t->pos;
+        if (p >= t->end) {
+            // a delta time with no event after it
+            smf->error = SMF_ERR_TRUNCATED;
+            return false;
+        }
+        status = *p;
+        if (status & 0x80) {
+            p++;
+        } else if (t->status) {
+            // running status, p is on the first data byte
+            status = t->status;
+        } else {
+            smf->error = SMF_ERR_EVENT;
+            return false;
+        }
+
+        e->tick = t->tick;
+        e->track = t - smf->tracks;
+
+        if (status < 0xf0) {
+            // channel message, one data byte for program and channel pressure
+            int n = (status & 0xf0) == SMF_PROGRAM || (status & 0xf0) == SMF_CHANNEL_PRESSURE ? 1 : 2;
+            if (t->end - p < n) {
+                smf->error = SMF_ERR_TRUNCATED;
+                return false;
+            }
+            t->status = status;
+            e->type = status & 0xf0;
+            e->channel = status & 0x0f;
+            e->data1 = p[0] & 0x7f;
+            e->data2 = n > 1 ? p[1] & 0x7f : 0;
+            e->tempo = 0;
+            // a note on with velocity 0 is a note off
+            if (e->type == SMF_NOTE_ON && e->data2 == 0) e->type = SMF_NOTE_OFF;
+            p += n;
+            emit = true;
+        } else if (status == 0xff) {
+            // meta event: type, length, data
+            uint8_t type;
+            if (p >= t->end) {
+                smf->error = SMF_ERR_TRUNCATED;
+                return false;
+            }
+            type = *p++;
+            if (!read_varint(&p, t->end, &len) || len > (size_t)(t->end - p)) {
+                smf->error = SMF_ERR_TRUNCATED;
+                return false;
+            }
+            if (type == 0x2f) {
+                // end of track, whatever follows is ignored
+                t->done = true;
+                continue;
+            }
+            if (type == SMF_TEMPO && len >= 3) {
+                // later events are timed from here at the new tempo
+                smf->tempo_us = smf_tick_us(smf, t->tick);
+                smf->tempo_tick = t->tick;
+                smf->tempo = ((uint32_t)p[0] << 16) | (p[1] << 8) | p[2];
+                e->type = SMF_TEMPO;
+                e->channel = e->data1 = e->data2 = 0;
+                e->tempo = smf->tempo;
+                emit = true;
+            }
+            p += len;
+            t->status = 0;
+        } else if (status == 0xf0 || status == 0xf7) {
+            // sysex, skipped
+            if (!read_varint(&p, t->end, &len) || len > (size_t)(t->end - p)) {
+                smf->error = SMF_ERR_TRUNCATED;
+                return false;
+            }
+            p += len;
+            t->status = 0;
+        } else {
+            // realtime and common system messages do not belong in a file
+            smf->error = SMF_ERR_EVENT;
+            return false;
+        }
+
+        t->pos = p;
+        e->time_us = smf_tick_us(smf, e->tick);
+        if (!track_advance(smf, t)) return false;
+        if (emit) return true;
+    }
+    return false;
+}
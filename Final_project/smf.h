@@ -0,0 +1,84 @@
+/**
+ * Standard MIDI File reader
+ *
+ * Parses type 0 and type 1 files in place: the file stays where it is
+ * (flash, a host buffer or an mmap) and the reader only keeps a cursor
+ * per track, so it needs no heap and runs the same on the host and on
+ * the Pico. Tracks are merged into one stream ordered by tick, with
+ * tempo meta events applied so every event also carries its time in us.
+ */
+
+#ifndef SMF_H
+#define SMF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// more tracks than this and smf_open() refuses the file
+#define SMF_MAX_TRACKS 16
+// 120 bpm, the tempo until the first set tempo meta event
+#define SMF_DEFAULT_TEMPO 500000
+
+enum smf_status {
+    SMF_OK = 0,
+    SMF_ERR_HEADER = -1,    // no MThd or a short header
+    SMF_ERR_FORMAT = -2,    // type 2, or type 0 with several tracks
+    SMF_ERR_TRACKS = -3,    // more than SMF_MAX_TRACKS
+    SMF_ERR_TRUNCATED = -4, // a chunk or event runs past the end
+    SMF_ERR_EVENT = -5,     // data byte with no running status
+};
+
+// event types, channel messages keep their MIDI status nibble
+enum smf_type {
+    SMF_NOTE_OFF = 0x80,
+    SMF_NOTE_ON = 0x90,
+    SMF_POLY_PRESSURE = 0xa0,
+    SMF_CONTROL = 0xb0,
+    SMF_PROGRAM = 0xc0,
+    SMF_CHANNEL_PRESSURE = 0xd0,
+    SMF_PITCH_BEND = 0xe0,
+    SMF_TEMPO = 0x51,       // data is the new tempo in us per quarter
+};
+
+typedef struct smf_event {
+    uint32_t tick;     // absolute, in file ticks
+    uint64_t time_us;  // absolute, after tempo changes
+    uint32_t tempo;    // SMF_TEMPO only
+    uint8_t type;      // enum smf_type
+    uint8_t channel;
+    uint8_t data1;     // note, controller or program
+    uint8_t data2;     // velocity or value, 0 for one byte messages
+    uint8_t track;
+} smf_event_t;
+
+typedef struct smf_track {
+    const uint8_t *pos;
+    const uint8_t *end;
+    uint32_t tick;     // absolute tick of the event at pos
+    uint8_t status;    // running status
+    bool done;
+} smf_track_t;
+
+typedef struct smf {
+    int format;
+    int num_tracks;
+    uint16_t division;  // raw header word, see smf_open()
+    int error;          // first error met while reading, SMF_OK if none
+    uint32_t tempo;
+    uint32_t tempo_tick;    // tick and time of the last tempo change
+    uint64_t tempo_us;
+    smf_track_t tracks[SMF_MAX_TRACKS];
+} smf_t;
+
+// reads the header and finds the tracks; returns SMF_OK or an smf_status.
+// data must stay valid while events are read
+int smf_open(smf_t *smf, const uint8_t *data, size_t size);
+// next channel or tempo event of all tracks by tick, ties in track order.
+// false at the end of every track or after a malformed event, in which
+// case smf->error says why
+bool smf_next(smf_t *smf, smf_event_t *e);
+// microseconds from the start of the file to tick at the current tempo
+uint64_t smf_tick_us(const smf_t *smf, uint32_t tick);
+
+#endif
@@ -1,22537 +0,0 @@
-#include "song.h"
-long song_len1 = 1056;
-note_t song_data1[1056] = {
-    {
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 96
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 86
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 86
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 112
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 234
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 234
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 234
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 144
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 176
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 170
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 86
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 58
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 58
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 102
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 86
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 166
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 86
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 0
-    }
-};
-
-long song_len2 = 1114;
-note_t song_data2[1114] = {
-    {
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 128
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 128
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 94
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 46,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 46,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 128
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 94
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 96
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 94
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 128
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 94
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 94
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 94
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 160
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 128
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 160
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 128
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 94
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 194
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 290
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 94
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 128
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 94
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 94
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 94
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 94
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 336
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 48
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 94
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 94
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 94
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 94
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 94
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 94
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 0
-    },{
-        .notes_press = 49,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 49,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 94
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 94
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 290
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 94
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 224
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 94
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 94
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 94
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 94
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 94
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 94
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 94
-    },{
-        .notes_press = 58,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 58,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 32
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 160
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 320
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 720
-    }
-};
-
-long song_len3 = 148;
-note_t song_data3[148] = {
-    {
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 384
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 7
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 121
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 254
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 5
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 763
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 15
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 369
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 7
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 121
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 254
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 251
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 256
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 217
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 39
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 512
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 507
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 15
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 497
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 724
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 39
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 512
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 5
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 379
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 7
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 121
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 2
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 254
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 5
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 379
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 7
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 121
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 254
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 724
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 39
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 512
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 5
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 379
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 7
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 121
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 2
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 254
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 5
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 379
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 7
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 121
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 254
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 251
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 256
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 217
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 39
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 512
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 5
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 251
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 5
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 251
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 5
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 251
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 5
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 763
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 15
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 714
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 39
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 256
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 5
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 251
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 5
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 251
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 5
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 379
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 7
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 121
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 2
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 254
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 724
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 39
-    }
-};
-
-long song_len4 = 286;
-note_t song_data4[286] = {
-    {
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 137
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 69
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 9
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 56
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = 36,
-        .notes_release = -1,
-        .hold_time = 17
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 22
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 9
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 7
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 64
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 123
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 68
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 51
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 164
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 63
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 36,
-        .hold_time = 24
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 42
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 4
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 13
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 7
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 19
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 20
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 43
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 130
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 48
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 138
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 113
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 20
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 61
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 60
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 4
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 8
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 16
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 43
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 145
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 70
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 60
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 78
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 60
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 161
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 20
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 11
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 25
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 11
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 70
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 15
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 24
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 442
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 13
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 0
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 63
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 3
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 63
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 3
-    },{
-        .notes_press = 36,
-        .notes_release = -1,
-        .hold_time = 18
-    },{
-        .notes_press = 40,
-        .notes_release = -1,
-        .hold_time = 17
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 69
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 107
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 86
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 89
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 88
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 97
-    },{
-        .notes_press = -1,
-        .notes_release = 36,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 40,
-        .hold_time = 9
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 50
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 8
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 4
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 15
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 4
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 51
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 125
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 77
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 104
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 79
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 96
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 8
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 66
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 10
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 48
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 33
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 21
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 13
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 186
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 75
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 114
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 58
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 135
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 28
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 7
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 26
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 68
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 2
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 9
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 13
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 13
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 353
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 20
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 9
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 146
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 10
-    },{
-        .notes_press = 40,
-        .notes_release = -1,
-        .hold_time = 35
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 8
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 8
-    },{
-        .notes_press = -1,
-        .notes_release = 40,
-        .hold_time = 257
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 6
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 88
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 90
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 17
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 7
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 19
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 31
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 130
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 16
-    },{
-        .notes_press = 36,
-        .notes_release = -1,
-        .hold_time = 34
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 7
-    },{
-        .notes_press = -1,
-        .notes_release = 36,
-        .hold_time = 213
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 8
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 115
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 35,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 11
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 100
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 11
-    },{
-        .notes_press = -1,
-        .notes_release = 35,
-        .hold_time = 26
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 11
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 15
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 1
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 117
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 65
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 209
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 28
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 111
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 100
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 17
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 8
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 43
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 3
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 116
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 10
-    },{
-        .notes_press = 36,
-        .notes_release = -1,
-        .hold_time = 52
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 36,
-        .hold_time = 203
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 10
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 146
-    },{
-        .notes_press = 35,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 1
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 17
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 35
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 18
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 40
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 13
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 50
-    },{
-        .notes_press = -1,
-        .notes_release = 35,
-        .hold_time = 59
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 11
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 74
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 66
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 4
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 57
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 24
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 37
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 147
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 111
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 110
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 9
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 43
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 1
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 127
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 10
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 55
-    },{
-        .notes_press = 36,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 36,
-        .hold_time = 209
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 9
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 127
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 3
-    },{
-        .notes_press = 35,
-        .notes_release = -1,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 2
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 121
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 14
-    },{
-        .notes_press = -1,
-        .notes_release = 35,
-        .hold_time = 15
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 21
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 127
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 7
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 65
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 2
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 1
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 181
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 5
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 25
-    },{
-        .notes_press = 41,
-        .notes_release = -1,
-        .hold_time = 147
-    },{
-        .notes_press = 53,
-        .notes_release = -1,
-        .hold_time = 6
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 5
-    },{
-        .notes_press = 45,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 45,
-        .hold_time = 187
-    },{
-        .notes_press = -1,
-        .notes_release = 41,
-        .hold_time = 5
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 53,
-        .hold_time = 8
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 60
-    },{
-        .notes_press = 36,
-        .notes_release = -1,
-        .hold_time = 115
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 8
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 197
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 36,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 9
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 31
-    },{
-        .notes_press = 35,
-        .notes_release = -1,
-        .hold_time = 114
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 14
-    },{
-        .notes_press = 50,
-        .notes_release = -1,
-        .hold_time = 7
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 197
-    },{
-        .notes_press = -1,
-        .notes_release = 50,
-        .hold_time = 3
-    },{
-        .notes_press = -1,
-        .notes_release = 35,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 27
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 99
-    },{
-        .notes_press = 47,
-        .notes_release = -1,
-        .hold_time = 21
-    },{
-        .notes_press = -1,
-        .notes_release = 47,
-        .hold_time = 30
-    },{
-        .notes_press = 36,
-        .notes_release = -1,
-        .hold_time = 47
-    },{
-        .notes_press = 40,
-        .notes_release = -1,
-        .hold_time = 7
-    },{
-        .notes_press = 43,
-        .notes_release = -1,
-        .hold_time = 11
-    },{
-        .notes_press = 48,
-        .notes_release = -1,
-        .hold_time = 8
-    },{
-        .notes_press = -1,
-        .notes_release = 36,
-        .hold_time = 328
-    },{
-        .notes_press = -1,
-        .notes_release = 40,
-        .hold_time = 156
-    },{
-        .notes_press = -1,
-        .notes_release = 43,
-        .hold_time = 99
-    },{
-        .notes_press = -1,
-        .notes_release = 48,
-        .hold_time = 150
-    }
-};
-
-long song_len5 = 3024;
-note_t song_data5[3024] = {
-    {
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 480
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 90
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 450
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 480
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 90
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 450
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 240
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 240
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 480
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 124
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 116
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 480
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 4
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 36
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 40
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 40
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 450
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 240
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 240
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 480
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 124
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 116
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 480
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 4
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 36
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 40
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 40
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 450
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 450
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 450
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 12
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 108
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 438
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 12
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 108
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 438
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 103
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 103
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 108
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 240
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 132
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 103
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 103
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 108
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 360
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 12
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 108
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 438
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 103
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 103
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 108
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 240
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 132
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 103
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 103
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 5
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 12
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 12
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 108
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 360
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 12
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 12
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 108
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 70,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 70,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 12
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 12
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 12
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 108
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 12
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 438
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 450
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 0
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 450
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 480
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 90
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 450
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 480
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 90
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 450
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 240
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 240
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 480
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 124
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 116
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 480
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 4
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 36
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 40
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 40
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 450
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 240
-    },{
-        .notes_press = 55,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 55,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 67,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 67,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 240
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 0
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 0
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 360
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 63,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 63,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 480
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 72,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 72,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 65,
-        .notes_release = -1,
-        .hold_time = 124
-    },{
-        .notes_press = -1,
-        .notes_release = 65,
-        .hold_time = 120
-    },{
-        .notes_press = 62,
-        .notes_release = -1,
-        .hold_time = 116
-    },{
-        .notes_press = -1,
-        .notes_release = 62,
-        .hold_time = 120
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 480
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 4
-    },{
-        .notes_press = 60,
-        .notes_release = -1,
-        .hold_time = 36
-    },{
-        .notes_press = -1,
-        .notes_release = 60,
-        .hold_time = 40
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 40
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 60
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 60
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 450
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 450
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 240
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 54,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 54,
-        .hold_time = 120
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 120
-    },{
-        .notes_press = 59,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 59,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 120
-    },{
-        .notes_press = 56,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 56,
-        .hold_time = 120
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 120
-    },{
-        .notes_press = 52,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 52,
-        .hold_time = 120
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 120
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 360
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 90
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 10
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 450
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 10
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 930
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 180
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 840
-    },{
-        .notes_press = 76,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 76,
-        .hold_time = 90
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 450
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 10
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 930
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 930
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 180
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 420
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 360
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 900
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 30
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 30
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 960
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 930
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 180
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 840
-    },{
-        .notes_press = 76,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 76,
-        .hold_time = 90
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 450
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 10
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 10
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 480
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = 66,
-        .notes_release = -1,
-        .hold_time = 60
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 74,
-        .notes_release = -1,
-        .hold_time = 930
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 66,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 74,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 930
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 30
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 150
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 30
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 68,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 71,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 71,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 68,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 180
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 720
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 180
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 720
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 180
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 720
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 60
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 180
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 73,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 73,
-        .hold_time = 120
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 120
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    },{
-        .notes_press = 57,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 61,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 64,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = 69,
-        .notes_release = -1,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 69,
-        .hold_time = 480
-    },{
-        .notes_press = -1,
-        .notes_release = 57,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 61,
-        .hold_time = 0
-    },{
-        .notes_press = -1,
-        .notes_release = 64,
-        .hold_time = 0
-    }
-};
\ No newline at end of file
@@ -1,21 +1,66 @@
+/**
+ * Packed songs
+ *
+ * Songs are compiled from the .mid files in songs/ at build time by
+ * tools/songc into the byte format below and linked into flash.
+ * protothread_playsong decodes them in place with song_next().
+ */
 
-typedef struct note_event {
-    int notes_press;   // which note to play
-    int notes_release; // which note to release
-    int hold_time;     // number of ticks to hold for
-} note_t;
+#ifndef SONG_H
+#define SONG_H
 
-extern note_t song_data1[];
-extern long song_len1;
+#include <stdint.h>
+#include <stdbool.h>
 
-extern note_t song_data2[];
-extern long song_len2;
+// ==================================================================
+// === packed song format
+// ==================================================================
+// A song is a byte stream of events, each
+//   delta   varint, 7 bits per byte, low bits first, bit 7 = more follows.
+//           The value is the wait in song ticks << 1; bit 0 set means a
+//           velocity byte follows the note byte
+//   note    bit 7 = press (1) or release (0), bits 0-6 MIDI note
+//   [vel]   1..127, sticks for the following presses
+// Velocity starts at SONG_DEFAULT_VELOCITY and is only written when it
+// changes, so songs without dynamics spend two bytes on most events.
+#define SONG_NOTE_ON 0x80
+#define SONG_NOTE_MASK 0x7f
+#define SONG_DEFAULT_VELOCITY 100
+// longest encoding of one event: 5 byte varint + note + velocity
+#define SONG_EVENT_MAX_BYTES 7
 
-extern note_t song_data3[];
-extern long song_len3;
+// one decoded event
+typedef struct song_event {
+    uint32_t delta;         // song ticks to wait before the event
+    unsigned char note;     // MIDI note
+    unsigned char velocity; // current velocity, presses only
+    bool on;
+} song_event_t;
 
-extern note_t song_data4[];
-extern long song_len4;
+// packed song, compiled from songs/*.mid by songc and kept in flash
+typedef struct song {
+    const uint8_t *data;
+    uint32_t size;    // bytes
+    uint32_t events;
+    uint32_t tick_us; // length of a song tick, tempo changes are baked in
+} song_t;
 
-extern note_t song_data5[];
-extern long song_len5;
+// streaming decoder state, reads the bytes in place through XIP
+typedef struct song_reader {
+    const uint8_t *pos;
+    const uint8_t *end;
+    unsigned char velocity;
+} song_reader_t;
+
+// every song in songs/, in file name order; the generated song_index.h
+// has SONG_COUNT and a SONG_<NAME> index for each
+extern const song_t *const songs[];
+extern const int num_songs;
+
+void song_open(const song_t *song, song_reader_t *r);
+bool song_next(song_reader_t *r, song_event_t *e);
+// encoder: writes one event at out, returns the bytes used.
+// velocity is the reader's current value, updated when a byte is written
+int song_encode(uint8_t *out, const song_event_t *e, unsigned char *velocity);
+
+#endif
@@ -0,0 +1,51 @@
+// packed song encoder and streaming decoder, see song.h for the format
+#include "song.h"
+
+void song_open(const song_t *song, song_reader_t *r) {
+    r->pos = song->data;
+    r->end = song->data + song->size;
+    r->velocity = SONG_DEFAULT_VELOCITY;
+}
+
+// next event, false at the end of the song or on a truncated event
+bool song_next(song_reader_t *r, song_event_t *e) {
+    const uint8_t *p = r->pos;
+    uint32_t delta = 0;
+    int shift = 0;
+    uint8_t b;
+    do {
+        if (p >= r->end || shift > 28) return false;
+        b = *p++;
+        delta |= (uint32_t)(b & 0x7f) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    if (p >= r->end) return false;
+    b = *p++;
+    if (delta & 1) {
+        if (p >= r->end) return false;
+        r->velocity = *p++;
+    }
+    e->delta = delta >> 1;
+    e->note = b & SONG_NOTE_MASK;
+    e->on = (b & SONG_NOTE_ON) != 0;
+    e->velocity = r->velocity;
+    r->pos = p;
+    return true;
+}
+
+int song_encode(uint8_t *out, const song_event_t *e, unsigned char *velocity) {
+    bool vel = e->on && e->velocity != *velocity;
+    uint32_t v = (e->delta << 1) | vel;
+    int n = 0;
+    while (v >= 0x80) {
+        out[n++] = (v & 0x7f) | 0x80;
+        v >>= 7;
+    }
+    out[n++] = v;
+    out[n++] = (e->on ? SONG_NOTE_ON : 0) | (e->note & SONG_NOTE_MASK);
+    if (vel) {
+        out[n++] = e->velocity;
+        *velocity = e->velocity;
+    }
+    return n;
+}
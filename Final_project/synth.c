@@ -0,0 +1,722 @@
+/**
+ * FM synthesis engine -- see synth.h
+ *
+ * Runs on core 1 from the DAC DMA interrupt, one block at a time.
+ */
+
+#include <stdio.h>
+#include "synth.h"
+
+// voice pool
+voice_t voices[SYNTH_MAX_VOICES];
+uint32_t active_voices = 0;
+signed char key_voice[NUM_KEYS];
+
+// mixer gain, Q10, slews once per block toward mix_gain[sounding voices]
+static int mix_level = 2048;
+
+// polyphony and cycle budget
+int polyphony = SYNTH_MAX_VOICES;
+int voice_limit = SYNTH_MAX_VOICES;
+static uint32_t budget_cycles = 0;      // per sample, 0 until the DAC is set up
+// per voice_kind, FM and sample playback cost differently
+static uint32_t voice_cycles[NUM_VOICE_KINDS] = { SYNTH_CYCLES_PER_VOICE, SYNTH_CYCLES_PER_VOICE };
+static int audible_voices = 0;          // active voices after the last span
+static uint32_t voice_samples[NUM_VOICE_KINDS];     // audible voices summed over this block
+
+// waveform amplities -- must fit in +/-11 bits for DAC
+fix max_amp = float_to_fix(1000.0);
+fix onefix = int_to_fix(1);
+
+// note event rings and the sample clock they are stamped against
+note_queue_t note_queues[NUM_NOTE_SOURCES];
+volatile uint32_t synth_samples = 0;
+
+// parameter blocks, double buffered -- the live one and the spare the
+// FM thread edits. Both are built on core 1 below the DMA ISR, which
+// cannot be preempted by the editor, so latching once per block is enough.
+static synth_params_t param_blocks[2];
+static synth_params_t *volatile live_params = &param_blocks[0];
+
+static void voice_lists_init(void);
+
+void synth_init(void)
+{
+    active_voices = 0;
+    audible_voices = 0;
+    mix_level = mix_gain[0];
+    for (int i = 0; i < NUM_KEYS; i++) {
+        key_voice[i] = -1; // no keys pressed initially
+    }
+    voice_lists_init();
+}
+
+// ==================================================
+// === envelope stages
+// ==================================================
+static void env_start(envelope_t *e, const env_shape_t *s)
+{
+    e->stage = ENV_ATTACK;
+    e->level = s->attack_inc;
+    e->inc = s->attack_inc;
+    e->remaining = s->attack_len;
+}
+
+// called when a stage runs out, sets up the next non-empty one
+static void env_next(voice_t *v, envelope_t *e, const env_shape_t *s)
+{
+    switch (e->stage) {
+    case ENV_ATTACK:
+    case ENV_HOLD:
+        // hold until the note-off, which ends the stage on its sample
+        if (v->held) {
+            e->stage = ENV_HOLD;
+            e->inc = 0;
+            e->remaining = -1;
+            return;
+        }
+        if (s->sustain_len > 0) {
+            e->stage = ENV_SUSTAIN;
+            e->inc = 0;
+            e->remaining = s->sustain_len;
+            return;
+        }
+        // fall through
+    case ENV_SUSTAIN:
+        if (s->decay_len > 0) {
+            e->stage = ENV_DECAY;
+            e->inc = -s->decay_inc;
+            e->remaining = s->decay_len;
+            if (s->quadratic) {
+                // first step is 2*decay_inc less one sample's shrink
+                v->decaying = true;
+                v->decay_step = ((long long)(s->decay_inc << 1) << DECAY_FRAC) - s->quad_dd;
+            }
+            return;
+        }
+        // fall through
+    default:
+        e->stage = ENV_IDLE;
+        e->level = 0;
+        e->inc = 0;
+        e->remaining = -1;  // counts away from 0, never fires again
+        if (s->quadratic) v->decaying = false;
+    }
+}
+
+// Move an envelope ENV_CONTROL_SAMPLES on at once, crossing stage ends as
+// they come. quad is set for the amplitude envelope of a parabolic decay
+// instrument: amp -= 2*decay_inc*(1 - t/decay_time), whose per-sample
+// step shrinks by quad_dd, so a run of k steps adds up in closed form.
+static inline __attribute__((always_inline)) void env_advance(voice_t *v, envelope_t *e, const env_shape_t *s, const bool quad)
+{
+    int k = ENV_CONTROL_SAMPLES;
+    while (k > 0) {
+        // remaining < 0 never runs out (hold, idle)
+        int step = (e->remaining > 0 && e->remaining < k) ? e->remaining : k;
+        if (quad && v->decaying) {
+            long long drop = v->decay_step * step - s->quad_dd * ((long long)step * (step - 1) >> 1);
+            // round up as the per-sample steps did
+            e->level -= (fix)((drop + ((1 << DECAY_FRAC) - 1)) >> DECAY_FRAC);
+            v->decay_step -= s->quad_dd * step;
+        }
+        else {
+            e->level += e->inc * step;
+        }
+        k -= step;
+        if (e->remaining > 0 && (e->remaining -= step) == 0) env_next(v, e, s);
+    }
+}
+
+// ==================================================
+// === oscillators
+// ==================================================
+int osc_mode = SYNTH_DEFAULT_OSC;
+
+// 256 entry full cycle, top 8 phase bits, no interpolation
+static inline fix sine_lookup(unsigned int phase)
+{
+    return sine_table[phase >> 24];
+}
+
+// quarter wave table, SINE_QUARTER_BITS of index and a 15 bit fraction
+// for the linear interpolation. The 2nd and 4th quadrants read the table
+// backwards, the 3rd and 4th are negated.
+static inline fix sine_interp(unsigned int phase)
+{
+    unsigned int x = (phase & 0x40000000) ? ~phase : phase;
+    unsigned int idx = (x >> (30 - SINE_QUARTER_BITS)) & ((1 << SINE_QUARTER_BITS) - 1);
+    int frac = (x >> (30 - SINE_QUARTER_BITS - 15)) & 0x7fff;
+    int a = sine_quarter[idx];
+    // s1x15 to s19x12
+    int y = (a + (((sine_quarter[idx + 1] - a) * frac) >> 15)) >> 3;
+    return (phase & 0x80000000) ? -y : y;
+}
+
+#define oscillator(osc, phase) ((osc) == OSC_INTERP ? sine_interp(phase) : sine_lookup(phase))
+
+// sample playback, a kernel variant rather than a user oscillator mode
+#define OSC_PCM 2
+
+// Read the voice's multisample at main_accum, 16 bit frame and 15 bit
+// fraction, linearly interpolated, then step on and wrap into the loop.
+// Frames are read front to back, which keeps XIP fetching whole lines.
+static inline fix pcm_read(voice_t *v)
+{
+    const pcm_zone_t *z = v->zone;
+    unsigned int pos = v->main_accum >> 16;
+    int frac = (v->main_accum >> 1) & 0x7fff;
+    int a = z->data[pos];
+    // s1x15 to s19x12
+    int y = (a + (((z->data[pos + 1] - a) * frac) >> 15)) >> 3;
+    v->main_accum += v->main_inc;
+    if (v->main_accum >= (z->loop_end << 16)) v->main_accum -= (z->loop_end - z->loop_start) << 16;
+    return y;
+}
+
+static void voice_done(int slot);
+
+// ==================================================
+// === ISR routine -- RUNNING on core 1
+// ==================================================
+// Advance one voice count samples and add it into sum[]. Returns the
+// samples it sounded, fewer than count once its amplitude has run out.
+// osc, fm and quad are constants at every call, so each instrument type
+// gets its own copy of the loop with the unused work compiled out
+static inline __attribute__((always_inline)) int render_voice(const int osc, const bool fm, const bool quad,
+    voice_t *v, fix *left, fix *right, int count, const synth_params_t *p)
+{
+    fix mod_wave, main_wave, wave;
+
+    // start a burst on new data
+    if (v->start) {
+        // reset the start flag
+        v->start = false;
+        // restart both envelopes
+        env_start(&v->amp_env, &p->amp);
+        env_start(&v->mod_env, &p->mod);
+        v->decaying = false;
+        // new control point now, ramping from wherever the slot was
+        v->ctl_left = 0;
+        // phase lock the main frequency
+        v->main_accum = 0;
+    } // note start
+
+    for (int n = 0; n < count; n++) {
+        // next envelope control point, the levels ramp to it in between
+        if (v->ctl_left == 0) {
+            // play the burst as long as the amplitude is positive
+            if (v->amp_out <= 0 && v->amp_env.level <= 0) return n;
+            env_advance(v, &v->amp_env, &p->amp, quad);
+            v->amp_slope = (v->amp_env.level - v->amp_out) >> SYNTH_ENV_SHIFT;
+            // start a shifted remainder back so the ramp lands exactly
+            v->amp_out = v->amp_env.level - v->amp_slope * ENV_CONTROL_SAMPLES;
+            if (fm) {
+                env_advance(v, &v->mod_env, &p->mod, false);
+                v->mod_slope = (v->mod_env.level - v->mod_out) >> SYNTH_ENV_SHIFT;
+                v->mod_out = v->mod_env.level - v->mod_slope * ENV_CONTROL_SAMPLES;
+            }
+            v->ctl_left = ENV_CONTROL_SAMPLES;
+        }
+        v->ctl_left--;
+
+        if (osc == OSC_PCM) {
+            main_wave = pcm_read(v);
+        }
+        else if (fm) {
+            // update dds modulation freq
+            v->mod_accum += v->mod_inc;
+            mod_wave = oscillator(osc, v->mod_accum);
+            // update modulation amplitude envelope
+            v->mod_out += v->mod_slope;
+
+            // set dds main freq and FM modulate it
+            v->main_accum += v->main_inc + (unsigned int)mul(mod_wave, v->mod_out);
+        }
+        else {
+            v->main_accum += v->main_inc;
+        }
+        // update main waveform
+        if (osc != OSC_PCM) main_wave = oscillator(osc, v->main_accum);
+
+        // update amplitude envelope
+        v->amp_out += v->amp_slope;
+
+        // amplitide modulate and pan into the mix
+        wave = mul(main_wave, v->amp_out);
+        left[n] += (wave * v->pan_l) >> 8;
+        right[n] += (wave * v->pan_r) >> 8;
+    }
+    return count;
+}
+
+// one kernel per oscillator, FM on/off and linear/parabolic decay
+typedef int (*voice_kernel_t)(voice_t *v, fix *left, fix *right, int count, const synth_params_t *p);
+
+#define VOICE_KERNEL(name, osc, fm, quad) \
+static int name(voice_t *v, fix *left, fix *right, int count, const synth_params_t *p) \
+{ return render_voice(osc, fm, quad, v, left, right, count, p); }
+
+VOICE_KERNEL(voice_table_sine_lin, OSC_TABLE, false, false)
+VOICE_KERNEL(voice_table_sine_quad, OSC_TABLE, false, true)
+VOICE_KERNEL(voice_table_fm_lin, OSC_TABLE, true, false)
+VOICE_KERNEL(voice_table_fm_quad, OSC_TABLE, true, true)
+VOICE_KERNEL(voice_interp_sine_lin, OSC_INTERP, false, false)
+VOICE_KERNEL(voice_interp_sine_quad, OSC_INTERP, false, true)
+VOICE_KERNEL(voice_interp_fm_lin, OSC_INTERP, true, false)
+VOICE_KERNEL(voice_interp_fm_quad, OSC_INTERP, true, true)
+VOICE_KERNEL(voice_pcm_lin, OSC_PCM, false, false)
+VOICE_KERNEL(voice_pcm_quad, OSC_PCM, false, true)
+
+// [osc][fm][quadratic]
+static const voice_kernel_t voice_kernels[2][2][2] = {
+    { { voice_table_sine_lin, voice_table_sine_quad }, { voice_table_fm_lin, voice_table_fm_quad } },
+    { { voice_interp_sine_lin, voice_interp_sine_quad }, { voice_interp_fm_lin, voice_interp_fm_quad } },
+};
+// [quadratic], picked per voice so PCM and FM voices mix freely
+static const voice_kernel_t pcm_kernels[2] = { voice_pcm_lin, voice_pcm_quad };
+
+// Render the voices in mask into left[] and right[], lowest slot first. Voices that
+// ran out are returned in *spent for the caller to free; only core 1
+// touches the allocator. Adds the voice-samples rendered to rendered[kind].
+static void render_voices(uint32_t mask, fix *left, fix *right, int count, int osc, const synth_params_t *p,
+    uint32_t *spent, uint32_t *rendered)
+{
+    voice_kernel_t kernel = voice_kernels[osc == OSC_INTERP][p->fm][p->amp.quadratic];
+    voice_kernel_t pcm_kernel = pcm_kernels[p->amp.quadratic];
+    *spent = 0;
+    while (mask) {
+        int slot = __builtin_ctz(mask);
+        voice_t *v = &voices[slot];
+        mask &= mask - 1;
+        int n = (v->zone ? pcm_kernel : kernel)(v, left, right, count, p);
+        if (n < count) *spent |= 1u << slot;
+        rendered[v->zone ? VOICE_PCM : VOICE_FM] += n;
+    }
+}
+
+// full scale above the knee is approached along a lookup table instead of
+// wrapping or hard clipping, below it samples pass untouched. Entries are
+// 2^SOFT_CLIP_SHIFT input steps apart and interpolated, so the curve
+// moves at most one DAC step per input step.
+static inline int soft_limit(int x)
+{
+    int a = (x < 0) ? -x : x;
+    if (a < SOFT_CLIP_KNEE) return x;
+    a -= SOFT_CLIP_KNEE;
+    int idx = a >> SOFT_CLIP_SHIFT;
+    if (idx >= SOFT_CLIP_LEN) {
+        a = soft_clip[SOFT_CLIP_LEN];
+    }
+    else {
+        int frac = a & ((1 << SOFT_CLIP_SHIFT) - 1);
+        a = soft_clip[idx] + (((soft_clip[idx + 1] - soft_clip[idx]) * frac) >> SOFT_CLIP_SHIFT);
+    }
+    return (x < 0) ? -a : a;
+}
+
+// s19x12 sum to DAC units times the Q10 gain, no divide:
+// (sum >> 8) * gain >> 14 == sum / 4096 * gain / 1024
+#define mix_to_dac(sum, gain) ((soft_limit((((sum) >> 8) * (gain)) >> 14) + 2048) & 0xfff)
+
+// sums of both partitions to interleaved A/B DAC words
+static void mix_block(uint16_t *out, fix (*sum0)[AUDIO_BLOCK_SIZE], fix (*sum1)[AUDIO_BLOCK_SIZE], int count, int gain)
+{
+    for (int n = 0; n < count; n++) {
+        *out++ = DAC_config_chan_A | mix_to_dac(sum0[0][n] + sum1[0][n], gain);
+        *out++ = DAC_config_chan_B | mix_to_dac(sum0[1][n] + sum1[1][n], gain);
+    }
+}
+
+// ==================================================
+// === note events -- producers post, the ISR drains
+// ==================================================
+static void note_on(int key, int src);
+static void note_off(int key);
+static void all_notes_off(int src);
+
+bool synth_post_note(int src, int key, bool on, uint32_t time)
+{
+    note_queue_t *q = &note_queues[src];
+    uint32_t head = q->head;
+    uint32_t depth = head - q->tail;
+    if (depth >= NOTE_QUEUE_SIZE) {
+        q->dropped++;
+        return false;
+    }
+    synth_event_t *e = &q->ev[head & (NOTE_QUEUE_SIZE - 1)];
+    e->time = time;
+    e->key = key;
+    e->on = on;
+    if (depth + 1 > q->max_depth) q->max_depth = depth + 1;
+    // the event must be written before the ISR can see the new head
+    __sync_synchronize();
+    q->head = head + 1;
+    return true;
+}
+
+// Apply every queued event due at or before sample now, oldest first
+// across the rings. Returns the time of the next event still waiting,
+// or limit if none is due before it.
+static uint32_t apply_events(uint32_t now, uint32_t limit)
+{
+    while (1) {
+        note_queue_t *first = NULL;
+        synth_event_t *e = NULL;
+        for (int s = 0; s < NUM_NOTE_SOURCES; s++) {
+            note_queue_t *q = &note_queues[s];
+            uint32_t tail = q->tail;
+            if (tail == q->head) continue;
+            __sync_synchronize();
+            synth_event_t *qe = &q->ev[tail & (NOTE_QUEUE_SIZE - 1)];
+            if (e == NULL || (int32_t)(qe->time - e->time) < 0) {
+                first = q;
+                e = qe;
+            }
+        }
+        if (e == NULL) return limit;
+        if ((int32_t)(e->time - now) > 0) {
+            return ((int32_t)(e->time - limit) < 0) ? e->time : limit;
+        }
+        // stamped for a sample that has already been rendered
+        if ((int32_t)(e->time - now) < 0) first->late++;
+
+        if (e->key == NOTE_ALL_OFF) all_notes_off(first - note_queues);
+        else if (e->key >= 0 && e->key < NUM_KEYS) {
+            if (e->on) note_on(e->key, first - note_queues);
+            else note_off(e->key);
+        }
+        // done with the slot before the producer may reuse it
+        __sync_synchronize();
+        first->tail++;
+    }
+}
+
+// ==================================================
+// === block renderer
+// ==================================================
+// left and right voice sums of this core and of the helper core
+static fix mix_sum[2][SYNTH_CHANNELS][AUDIO_BLOCK_SIZE];
+
+// helper core, see synth.h
+void (*synth_helper_start)(void) = NULL;
+void (*synth_helper_wait)(void) = NULL;
+bool synth_dual = false;
+
+// one span of the helper's voices, posted before synth_helper_start()
+static struct {
+    uint32_t mask;
+    int offset, count, osc;
+    const synth_params_t *p;
+    uint32_t spent, rendered[NUM_VOICE_KINDS];
+} helper_job;
+
+void synth_helper_render(void)
+{
+    helper_job.rendered[VOICE_FM] = helper_job.rendered[VOICE_PCM] = 0;
+    render_voices(helper_job.mask, mix_sum[1][0] + helper_job.offset, mix_sum[1][1] + helper_job.offset,
+        helper_job.count, helper_job.osc, helper_job.p, &helper_job.spent, helper_job.rendered);
+}
+
+void synth_set_dual(bool on)
+{
+    synth_dual = on && synth_helper_start && synth_helper_wait;
+}
+
+// every second active voice, so both halves get a share of long and
+// short notes
+static uint32_t split_voices(uint32_t mask)
+{
+    uint32_t half = 0;
+    while (mask) {
+        mask &= mask - 1;           // skip one
+        half |= mask & -mask;       // take the next
+        mask &= mask - 1;
+    }
+    return half;
+}
+
+// render samples [offset, offset+count) of the block, on one or both cores
+static void render_span(int offset, int count, int osc, const synth_params_t *p)
+{
+    uint32_t mask = active_voices;
+    uint32_t spent, helper = 0;
+
+    if (synth_dual && (mask & (mask - 1))) {
+        helper = split_voices(mask);
+        helper_job.mask = helper;
+        helper_job.offset = offset;
+        helper_job.count = count;
+        helper_job.osc = osc;
+        helper_job.p = p;
+        synth_helper_start();
+    }
+    render_voices(mask & ~helper, mix_sum[0][0] + offset, mix_sum[0][1] + offset,
+        count, osc, p, &spent, voice_samples);
+    if (helper) {
+        synth_helper_wait();
+        spent |= helper_job.spent;
+        voice_samples[VOICE_FM] += helper_job.rendered[VOICE_FM];
+        voice_samples[VOICE_PCM] += helper_job.rendered[VOICE_PCM];
+    }
+
+    // both cores are done with the voices, free the ones that ran out
+    while (spent) {
+        voice_done(__builtin_ctz(spent));
+        spent &= spent - 1;
+    }
+    audible_voices = __builtin_popcount(active_voices);
+}
+
+// called from the DMA interrupt each time a block has been sent
+void synth_render_block(uint16_t *out, int count)
+{
+    // longer requests go through in whole blocks
+    while (count > AUDIO_BLOCK_SIZE) {
+        synth_render_block(out, AUDIO_BLOCK_SIZE);
+        out += SYNTH_CHANNELS * AUDIO_BLOCK_SIZE;
+        count -= AUDIO_BLOCK_SIZE;
+    }
+
+    // oscillator mode and parameters are latched once per block
+    const int osc = osc_mode;
+    const synth_params_t *p = live_params;
+    uint32_t start = synth_samples;
+    uint32_t end = start + count;
+    uint32_t now = start;
+
+    // follow the voice count down at once so chords stay clear of the
+    // clipper, and back up gently so a release does not pump
+    int target = mix_gain[__builtin_popcount(active_voices)];
+    if (target < mix_level) mix_level = target;
+    else mix_level += (target - mix_level + 7) >> 3;
+
+    for (int n = 0; n < count; n++) {
+        mix_sum[0][0][n] = mix_sum[0][1][n] = 0;
+        mix_sum[1][0][n] = mix_sum[1][1][n] = 0;
+    }
+
+    // render up to each event's sample, then apply it
+    while (now != end) {
+        uint32_t next = apply_events(now, end);
+        render_span(now - start, next - now, osc, p);
+        now = next;
+    }
+    synth_samples = end;
+
+    mix_block(out, mix_sum[0], mix_sum[1], count, mix_level);
+}
+
+// ==================================================
+// === parameter blocks
+// ==================================================
+synth_params_t *synth_params_edit(void)
+{
+    synth_params_t *spare = (live_params == &param_blocks[0]) ? &param_blocks[1] : &param_blocks[0];
+    *spare = *live_params;
+    return spare;
+}
+
+void synth_publish_params(synth_params_t *p)
+{
+    // zero depth leaves both modulator increments at zero
+    p->fm = (p->mod.attack_inc != 0 || p->mod.decay_inc != 0);
+    // every field must be visible before the pointer is
+    __sync_synchronize();
+    live_params = p;
+}
+
+void synth_set_oscillator(int mode) {
+    osc_mode = (mode == OSC_INTERP) ? OSC_INTERP : OSC_TABLE;
+}
+
+// ==================================================
+// === polyphony and cycle budget
+// ==================================================
+static void update_voice_limit(void) {
+    int limit = polyphony;
+    if (budget_cycles > SYNTH_CYCLES_PER_SAMPLE) {
+        // voices of the kind new notes get that fit in the share of a
+        // sample period we may use
+        uint32_t cost = voice_cycles[live_params->pcm ? VOICE_PCM : VOICE_FM];
+        int fit = (int)((budget_cycles * SYNTH_LOAD_PERCENT / 100 - SYNTH_CYCLES_PER_SAMPLE) / cost);
+        if (fit < 1) fit = 1;
+        if (fit < limit) limit = fit;
+    }
+    voice_limit = limit;
+}
+
+void synth_set_polyphony(int n) {
+    if (n < 1) n = 1;
+    if (n > SYNTH_MAX_VOICES) n = SYNTH_MAX_VOICES;
+    polyphony = n;
+    update_voice_limit();
+}
+
+uint32_t synth_voice_cycles(int kind) {
+    return voice_cycles[kind];
+}
+
+void synth_set_budget(uint32_t cycles_per_sample) {
+    budget_cycles = cycles_per_sample;
+    update_voice_limit();
+}
+
+// One time covers both kinds, so a block refines the kind new notes get,
+// less what voices of the other kind cost by the average they were
+// measured at while they were the new ones. Blocks of one kind measure
+// it alone.
+void synth_block_timing(uint32_t cycles, int count) {
+    uint32_t fixed = (uint32_t)count * SYNTH_CYCLES_PER_SAMPLE;
+    int kind = live_params->pcm ? VOICE_PCM : VOICE_FM;
+    uint32_t other = voice_samples[kind ^ 1] * voice_cycles[kind ^ 1];
+    // only trust blocks busy enough for the voices to dominate
+    if (voice_samples[kind] >= (uint32_t)count * 2 && cycles > fixed + other) {
+        uint32_t measured = (cycles - fixed - other) / voice_samples[kind];
+        // smooth, and round up so a slow block is not forgotten at once
+        voice_cycles[kind] = (voice_cycles[kind] * 3 + measured + 3) >> 2;
+    }
+    // also picks up a switch between FM and sample playback
+    update_voice_limit();
+    voice_samples[VOICE_FM] = voice_samples[VOICE_PCM] = 0;
+}
+
+// ==================================================
+// === voice allocation
+// ==================================================
+// Every slot is on exactly one list -- free, released (key up, oldest
+// release first) or held (key down, oldest note-on first) -- linked
+// through the slots themselves, so note-on, note-off and steal are O(1).
+static struct { signed char head, tail; } voice_lists[NUM_VOICE_LISTS];
+
+static void list_unlink(int slot) {
+    voice_t *v = &voices[slot];
+    if (v->prev >= 0) voices[v->prev].next = v->next;
+    else voice_lists[v->list].head = v->next;
+    if (v->next >= 0) voices[v->next].prev = v->prev;
+    else voice_lists[v->list].tail = v->prev;
+}
+
+static void list_append(int list, int slot) {
+    voice_t *v = &voices[slot];
+    v->list = list;
+    v->next = -1;
+    v->prev = voice_lists[list].tail;
+    if (v->prev >= 0) voices[v->prev].next = slot;
+    else voice_lists[list].head = slot;
+    voice_lists[list].tail = slot;
+}
+
+static void voice_lists_init(void) {
+    for (int l = 0; l < NUM_VOICE_LISTS; l++) {
+        voice_lists[l].head = voice_lists[l].tail = -1;
+    }
+    // in slot order, a quiet synth keeps to the low slots
+    for (int i = 0; i < SYNTH_MAX_VOICES; i++) {
+        voices[i].key = -1;
+        list_append(VOICES_FREE, i);
+    }
+}
+
+// ==================================================
+// === panning
+// ==================================================
+int pan_mode = PAN_KEYS;
+
+void synth_set_pan_mode(int mode) {
+    pan_mode = (mode == PAN_DUET) ? PAN_DUET : PAN_KEYS;
+}
+
+// pan 0 (left) .. 256 (right) to channel gains, Q8. The centre keeps
+// both channels at full level so a mono part loses nothing.
+static void voice_pan(voice_t *v, int key, int src) {
+    int pan;
+    if (pan_mode == PAN_DUET) pan = (src == NOTE_SRC_SONG) ? PAN_DUET_SONG : 256 - PAN_DUET_SONG;
+    else pan = 64 + key * 128 / (NUM_KEYS - 1);     // low keys left, across the middle half
+    v->pan_l = (pan < 128) ? 256 : 2 * (256 - pan);
+    v->pan_r = (pan > 128) ? 256 : 2 * pan;
+}
+
+// ISR context only, from apply_events
+static void note_on(int key, int src) {
+    voice_t *v;
+    int slot = key_voice[key];
+
+    // either the key already has a voice, or take a free slot while under
+    // the limit, or steal the oldest released voice, then the oldest held
+    if (slot < 0) {
+        if (voice_lists[VOICES_FREE].head >= 0 && audible_voices < voice_limit) {
+            slot = voice_lists[VOICES_FREE].head;
+        }
+        else {
+            slot = voice_lists[VOICES_RELEASED].head;
+            if (slot < 0) slot = voice_lists[VOICES_HELD].head;
+            // counted while in the mask, even at level 0 before voice_done
+            if (active_voices & (1u << slot)) audible_voices--;
+            key_voice[voices[slot].key] = -1;
+        }
+        audible_voices++;
+    }
+    // newest note-on goes to the back of the held list
+    list_unlink(slot);
+    list_append(VOICES_HELD, slot);
+    v = &voices[slot];
+    v->key = key;
+    v->main_inc = live_params->main_inc[key];
+    v->mod_inc = live_params->mod_inc[key];
+    v->zone = live_params->pcm ? &pcm_zones[live_params->pcm_zone[key]] : NULL;
+    voice_pan(v, key, src);
+    v->src = src;
+    v->held = true;
+    v->start = true;
+    key_voice[key] = slot;
+    active_voices |= 1u << slot;
+}
+
+// amplitude ran out: unmap the key and free the slot straight away
+static void voice_done(int slot) {
+    voice_t *v = &voices[slot];
+    active_voices &= ~(1u << slot);
+    key_voice[v->key] = -1;
+    v->key = -1;
+    v->held = false;
+    list_unlink(slot);
+    list_append(VOICES_FREE, slot);
+}
+
+// key up: a voice in hold moves on at the next sample
+static void release(int slot) {
+    voice_t *v = &voices[slot];
+    if (!v->held) return;
+    v->held = false;
+    if (v->amp_env.stage == ENV_HOLD) v->amp_env.remaining = 1;
+    if (v->mod_env.stage == ENV_HOLD) v->mod_env.remaining = 1;
+    list_unlink(slot);
+    list_append(VOICES_RELEASED, slot);
+}
+
+static void note_off(int key) {
+    int slot = key_voice[key];
+    if (slot >= 0) {
+        release(slot);
+    }
+}
+
+// key up on every voice src struck last, the other source's notes hold
+static void all_notes_off(int src) {
+    int slot = voice_lists[VOICES_HELD].head;
+    while (slot >= 0) {
+        int next = voices[slot].next;
+        if (voices[slot].src == src) release(slot);
+        slot = next;
+    }
+}
+
+// debugging voice pool
+void print_notes(void) {
+    printf("voices :");
+    for (int i = 0; i < SYNTH_MAX_VOICES; i++) {
+        if (active_voices & (1u << i)) printf("%d, ", voices[i].key);
+    }
+    printf("\n");
+}
@@ -0,0 +1,347 @@
+/**
+ * FM synthesis engine
+ *
+ * Voice state, envelopes and the per-sample DDS kernel. Nothing in here
+ * touches RP2040 hardware, so the renderer can also be compiled and timed
+ * on a host machine. final_project.c owns the DAC, DMA and the threads.
+ *
+ * Output is rendered in blocks of AUDIO_BLOCK_SIZE stereo frames, each a
+ * channel A (left) then a channel B (right) DAC word, which are streamed
+ * to the SPI DAC by DMA.
+ */
+
+#ifndef SYNTH_H
+#define SYNTH_H
+
+// stdlib must come before the fixed point div() macro below
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// ==========================================
+// === fixed point s19x12 for DDS
+// ==========================================
+// s19x12 fixed point macros == for DDS
+typedef signed int fix;
+#define mul(a,b) ((fix)(((( signed long long )(a))*(( signed long long )(b)))>>12)) //multiply two fixed 16:16
+#define float_to_fix(a) ((fix)((a)*4096.0)) // 2^12
+#define fix_to_float(a) ((float)(a)/4096.0)
+#define fix_to_int(a)    ((int)((a)>>12))
+#define int_to_fix(a)    ((fix)((a)<<12))
+#define div(a,b) ((fix)((((signed long long)(a)<<12)/(b))))
+#define absfix(a) abs(a)
+typedef signed short s1x14;
+#define muls1x14(a,b) ((s1x14)((((int)(a))*((int)(b)))>>14))
+#define float_to_s1x14(a) ((s1x14)((a)*16384.0)) // 2^14
+#define s1x14_to_float(a) ((float)(a)/16384.0)
+#define abss1x14(a) abs(a)
+#define divs1x14(a,b) ((s1x14)((((signed int)(a)<<14)/(b))))
+// shift 12 bits into 14 bits so full scale dds is about 0.25
+#define dds_to_s1x14(a) ((s1x14)((a)>>14))
+
+// ==========================================
+// === placement
+// ==========================================
+// Data read by core 1 on every sample lives in scratch X, its own SRAM
+// bank next to the core 1 stack, rather than behind the XIP cache. The
+// bank is 4096 B: the 2048 B stack, sine_table 1024 B and sine_quarter
+// 514 B leave 510 B. Tables read less often go in main SRAM.
+#if PICO_ON_DEVICE
+#include "pico/platform.h"
+#define SYNTH_HOT_DATA(name) __scratch_x(#name) name
+#define SYNTH_RAM_DATA(name) __not_in_flash(#name) name
+#else
+#define SYNTH_HOT_DATA(name) name
+#define SYNTH_RAM_DATA(name) name
+#endif
+
+// ==========================================
+// === DAC words
+// ==========================================
+// A-channel, 1x, active
+#define DAC_config_chan_A 0b0011000000000000
+// B-channel, 1x, active
+#define DAC_config_chan_B 0b1011000000000000
+// DAC words per frame, A then B, so the DMA runs at twice the sample rate
+#define SYNTH_CHANNELS 2
+
+// ==========================================
+// === voices
+// ==========================================
+#define NUM_KEYS 50
+
+// one looped multisample of the sample-playback voice, 16 bit PCM in
+// flash. data[loop_end] repeats data[loop_start] for the interpolation.
+typedef struct pcm_zone {
+    const short *data;
+    uint32_t loop_start, loop_end;  // frames, loop_end < 65536
+    float root_hz;
+    int rate;                       // Hz the data was made at
+    int root;                       // MIDI note
+} pcm_zone_t;
+
+// sine, note, DDS increment and PCM tables from gen-tables.py
+#include "synth_tables.h"
+#if SYNTH_TABLE_KEYS != NUM_KEYS
+#error "gen-tables.py NUM_KEYS does not match synth.h"
+#endif
+
+// voice slots compiled in, override with -DSYNTH_MAX_VOICES=n (max 32,
+// one bit each in active_voices)
+#ifndef SYNTH_MAX_VOICES
+#define SYNTH_MAX_VOICES 32
+#endif
+#if SYNTH_MAX_VOICES > 32 || SYNTH_MAX_VOICES > MIX_MAX_VOICES
+#error "SYNTH_MAX_VOICES must fit the 32 bit active_voices mask"
+#endif
+
+// cost model used to cap polyphony before the DAC runs dry.
+// Starting guesses in sys_clk cycles, refined from measured block times.
+#ifndef SYNTH_CYCLES_PER_SAMPLE
+#define SYNTH_CYCLES_PER_SAMPLE 60
+#endif
+#ifndef SYNTH_CYCLES_PER_VOICE
+#define SYNTH_CYCLES_PER_VOICE 300
+#endif
+// share of each sample period the renderer may use
+#define SYNTH_LOAD_PERCENT 80
+
+// frames per rendered block -- 32 to 256
+// latency is two blocks, ~4.6 mSec at 64 samples and 27.7 kHz
+#define AUDIO_BLOCK_SIZE 64
+
+// envelopes are evaluated every 2^SYNTH_ENV_SHIFT samples and linearly
+// interpolated in between, 0 evaluates them every sample
+#ifndef SYNTH_ENV_SHIFT
+#define SYNTH_ENV_SHIFT 4
+#endif
+#define ENV_CONTROL_SAMPLES (1 << SYNTH_ENV_SHIFT)
+#if SYNTH_ENV_SHIFT < 0 || SYNTH_ENV_SHIFT >= 8
+#error "ENV_CONTROL_SAMPLES must fit the unsigned char voice_t.ctl_left"
+#endif
+
+// extra fraction bits on the quadratic decay step, so that the per-sample
+// change of the step (2*decay_inc/decay_time) does not round to zero
+#define DECAY_FRAC 20
+
+// ==========================================
+// === oscillators
+// ==========================================
+// OSC_TABLE:  256 entry sine, phase truncated to 8 bits (~37 dB SNR)
+// OSC_INTERP: quarter wave of 2^SINE_QUARTER_BITS points, linearly
+//             interpolated (~73 dB SNR, limited by the s19x12 output)
+enum osc_mode { OSC_TABLE, OSC_INTERP };
+// oscillator at boot, the firmware build sets it from SYNTH_OSCILLATOR
+#ifndef SYNTH_DEFAULT_OSC
+#define SYNTH_DEFAULT_OSC OSC_TABLE
+#endif
+extern int osc_mode;
+
+// ==========================================
+// === envelopes
+// ==========================================
+// Both envelopes run attack -> hold -> sustain -> decay -> idle. Hold lasts
+// while the key is down, sustain for sustain_len more samples, and decay
+// doubles as the release. Each stage adds a constant increment for a
+// precomputed number of samples. The stages are stepped at the control
+// rate, ENV_CONTROL_SAMPLES at a time, and a sample only adds a slope.
+enum env_stage { ENV_ATTACK, ENV_HOLD, ENV_SUSTAIN, ENV_DECAY, ENV_IDLE };
+
+typedef struct envelope {
+    fix level;
+    fix inc;            // added every sample
+    int remaining;      // samples left in this stage
+    unsigned char stage;
+} envelope_t;
+
+// stage lengths and increments, built by the FM parameter thread
+typedef struct env_shape {
+    fix attack_inc, decay_inc;
+    int attack_len, sustain_len, decay_len;
+    bool quadratic;     // parabolic instead of linear decay
+    long long quad_dd;  // change of the parabolic decay step per sample
+} env_shape_t;
+
+// ==========================================
+// === voice pool
+// ==========================================
+// Every sounding note owns one slot holding all of its oscillator and
+// envelope state, so the ISR walks one contiguous struct per voice.
+typedef struct voice {
+    // DDS
+    unsigned int main_inc, mod_inc;
+    unsigned int main_accum, mod_accum;
+    // amplitude and FM depth envelopes, at the next control point
+    envelope_t amp_env, mod_env;
+    // levels ramping toward them, one slope add per sample
+    fix amp_out, amp_slope, mod_out, mod_slope;
+    unsigned char ctl_left;     // samples to the control point
+    // left and right gains, Q8
+    short pan_l, pan_r;
+    // multisample of a sample-playback voice, NULL for FM
+    const pcm_zone_t *zone;
+    // parabolic decay step, s19x12 with DECAY_FRAC extra fraction bits
+    long long decay_step;
+    bool decaying;
+    // allocator list links, slot indices or -1
+    signed char prev, next;
+    unsigned char list;
+    signed char key;    // -1 when the slot has never been used
+    unsigned char src;  // note_source of the last note-on
+    bool start;         // restart the envelopes on the next sample
+    bool held;          // key still down, stretches the sustain
+} voice_t;
+
+// allocator lists, steals come off the front
+enum voice_list { VOICES_FREE, VOICES_RELEASED, VOICES_HELD, NUM_VOICE_LISTS };
+
+extern voice_t voices[SYNTH_MAX_VOICES];
+// bit per sounding slot, the only voices the ISR visits. A voice leaves
+// the mask and goes back on the free list when its amplitude runs out.
+extern uint32_t active_voices;
+// slot playing each key, or -1
+extern signed char key_voice[NUM_KEYS];
+// requested polyphony, and the audible voice cap after the cycle budget
+extern int polyphony, voice_limit;
+
+// waveform amplitude
+extern fix max_amp;
+extern fix onefix;
+
+// ==========================================
+// === instrument parameter blocks
+// ==========================================
+// Everything the ISR takes from the menu, built off the hot path by the
+// FM parameter thread and then published whole. The ISR latches the
+// pointer once per block, so an instrument switch is a single pointer
+// swap and no block ever mixes old and new values.
+typedef struct synth_params {
+    env_shape_t amp, mod;
+    // FM depth is not zero, set on publish to pick the voice kernel
+    bool fm;
+    // sample playback instead of FM: main_inc is then the Q16 frame step
+    // through pcm_zones[pcm_zone[key]]
+    bool pcm;
+    unsigned char pcm_zone[NUM_KEYS];
+    // per-key DDS increments
+    unsigned int main_inc[NUM_KEYS], mod_inc[NUM_KEYS];
+} synth_params_t;
+
+// one writer only: returns the spare block, preloaded with the live values
+synth_params_t *synth_params_edit(void);
+// make p the live block from the next rendered block on, and with it the
+// voice kernel specialized for its oscillator, FM and decay settings
+void synth_publish_params(synth_params_t *p);
+
+// Blocks are built from the menu's float values, in its order: Octave #,
+// Attack main, Sustain main, Decay main, Fmod/Fmain, FM depth max,
+// Attack FM, Sustain FM, Decay FM, Lin=1/Quad DK, Run. Times are in
+// seconds. See synth_params.c.
+#define SYNTH_MENU_LENGTH 11
+// menu minimum of the attack and decay times, which divide
+#define SYNTH_MIN_TIME 0.001f
+
+// the instrument buttons' menu values
+enum synth_preset { PRESET_HARP, PRESET_BELLS, PRESET_SINE, PRESET_PIANO, NUM_PRESETS };
+extern const float synth_presets[NUM_PRESETS][SYNTH_MENU_LENGTH];
+
+// raise the attack and decay times in m to SYNTH_MIN_TIME
+void synth_menu_clamp(float *m);
+// DDS increments for the keys at output rate rate, Fs the exact rate in
+// Hz; with pcm the keys play the nearest sample zone, key 0 is MIDI
+// note base_note
+void synth_build_pitch(synth_params_t *p, const float *m, int rate, float Fs, bool pcm, int base_note);
+// amplitude envelope
+void synth_build_amp_env(synth_params_t *p, const float *m, float Fs);
+// FM depth and its envelope
+void synth_build_mod_env(synth_params_t *p, const float *m, float Fs);
+
+// ==========================================
+// === note events
+// ==========================================
+// Input threads never touch the voices. Each one posts timestamped note
+// events to its own single-producer/single-consumer ring, and the DMA ISR,
+// the only consumer, applies them at their sample inside the block it is
+// rendering. Voice state is therefore only ever written on core 1.
+// Threads sharing a core and a scheduler count as one producer.
+enum note_source { NOTE_SRC_KEYS, NOTE_SRC_SONG, NUM_NOTE_SOURCES };
+// key of an event releasing every voice its source struck
+#define NOTE_ALL_OFF (-1)
+// ring length, a power of 2
+#define NOTE_QUEUE_SIZE 64
+
+typedef struct synth_event {
+    uint32_t time;      // sample index the event lands on
+    signed char key;
+    bool on;
+} synth_event_t;
+
+typedef struct note_queue {
+    synth_event_t ev[NOTE_QUEUE_SIZE];
+    volatile uint32_t head;     // written by the producer only
+    volatile uint32_t tail;     // written by the ISR only
+    uint32_t max_depth, dropped;    // producer side
+    uint32_t late;                  // ISR side, applied after their sample
+} note_queue_t;
+
+extern note_queue_t note_queues[NUM_NOTE_SOURCES];
+// index of the first sample of the next block to be rendered
+extern volatile uint32_t synth_samples;
+
+// clear all voices
+void synth_init(void);
+// fill out[0..SYNTH_CHANNELS*count-1] with count interleaved A/B frames
+void synth_render_block(uint16_t *out, int count);
+
+// queue a note-on or a note-off for sample time. A note-on starts or
+// restarts the key, stealing the oldest released voice, else the oldest
+// held one, when over the limit; a note-off moves the envelope on into
+// its decay. key may be NOTE_ALL_OFF with on false, which releases the
+// voices whose last note-on came from src and leaves the others held.
+// Returns false if the ring was full and the event was dropped.
+bool synth_post_note(int src, int key, bool on, uint32_t time);
+
+// ==========================================
+// === second core
+// ==========================================
+// In dual mode each span of a block is split between the cores: the
+// other core renders every second active voice through
+// synth_helper_render() while the rendering core does the rest, and the
+// sums are mixed once both are done. The platform supplies the handoff:
+// synth_helper_start() must get synth_helper_render() run on the other
+// core, synth_helper_wait() must return once it has finished, and both
+// must order memory. Until both are set, dual mode stays off.
+extern void (*synth_helper_start)(void);
+extern void (*synth_helper_wait)(void);
+extern bool synth_dual;
+void synth_helper_render(void);
+void synth_set_dual(bool on);
+
+// ==========================================
+// === stereo
+// ==========================================
+// PAN_KEYS: voices spread left to right by key
+// PAN_DUET: the song to one side and the player's keys to the other
+enum pan_mode { PAN_KEYS, PAN_DUET };
+// song position in duet mode, 0 left .. 256 right; the keys mirror it
+#define PAN_DUET_SONG 32
+extern int pan_mode;
+// takes effect from the next note-on
+void synth_set_pan_mode(int mode);
+
+// OSC_TABLE or OSC_INTERP, takes effect at the next block
+void synth_set_oscillator(int mode);
+// polyphony setting, 1..SYNTH_MAX_VOICES
+void synth_set_polyphony(int n);
+// measured sys_clk cycles per voice-sample of each kind, for the
+// current instrument
+enum voice_kind { VOICE_FM, VOICE_PCM, NUM_VOICE_KINDS };
+uint32_t synth_voice_cycles(int kind);
+// sys_clk cycles available per output sample
+void synth_set_budget(uint32_t cycles_per_sample);
+// cycles the last synth_render_block(..., count) took, refines the cost model
+void synth_block_timing(uint32_t cycles, int count);
+
+void print_notes(void);
+
+#endif
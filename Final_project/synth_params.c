@@ -0,0 +1,100 @@
+/**
+ * Menu values to parameter blocks -- see synth.h
+ *
+ * Runs in the FM parameter thread on core 1, never from the ISR. The
+ * host tests build their blocks through the same functions.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "synth.h"
+
+// the instrument buttons
+const float synth_presets[NUM_PRESETS][SYNTH_MENU_LENGTH] = {
+    // Octave, Attack, Sustain, Decay, Fmod/Fmain, FM depth, Attack FM, Sustain FM, Decay FM, Lin=1/Quad DK, Run
+    { 3, .0, .0, .5, 2, 2, .0, .0, .4, 0, 1 },                      // harp
+    { 1, 0.001, 0, 0.99, 1.6, 1.5, 0.001, 0, 0.90, 1, 1 },          // bells
+    { 3, .01, .0, 3, 3, 0, .01, 0, 3, 0, 1 },                       // sine
+    { 3, .01, .3, .5, 3, .25, .01, .1, .4, 0, 1 },                  // piano
+};
+
+void synth_menu_clamp(float *m)
+{
+    // attack and decay main, attack and decay FM: they divide below, and
+    // the presets set some to 0 past the menu's minimum
+    static const int divisor_items[4] = { 1, 3, 6, 8 };
+    for (int i = 0; i < 4; i++) {
+        if (m[divisor_items[i]] < SYNTH_MIN_TIME) m[divisor_items[i]] = SYNTH_MIN_TIME;
+    }
+}
+
+void synth_build_pitch(synth_params_t *p, const float *m, int rate, float Fs, bool pcm, int base_note)
+{
+    // main DDS increments come prebuilt for the rates in sample_rates
+    int rate_index = -1;
+    for (int r = 0; r < SYNTH_NUM_RATES; r++) {
+        if (sample_rates[r] == rate) rate_index = r;
+    }
+
+    // increment = Fout/Fs * 2^32
+    for (int i = 0; i < NUM_KEYS; i++) {
+        p->main_inc[i] = (rate_index >= 0) ? note_inc_table[rate_index][i] :
+            (unsigned int)(notes[i] * pow(2, 32) / Fs);
+        p->mod_inc[i] = m[4] * notes[i] * pow(2, 32) / Fs;
+    }
+
+    // sample playback: each key plays the zone with the nearest
+    // root, stepping through it at the pitch and rate ratio
+    p->pcm = pcm;
+    if (p->pcm) {
+        for (int i = 0; i < NUM_KEYS; i++) {
+            int z = 0;
+            for (int j = 1; j < PCM_NUM_ZONES; j++) {
+                if (abs(pcm_zones[j].root - (base_note + i)) < abs(pcm_zones[z].root - (base_note + i))) z = j;
+            }
+            p->pcm_zone[i] = z;
+            p->main_inc[i] = (unsigned int)(notes[i] / pcm_zones[z].root_hz *
+                pcm_zones[z].rate / Fs * 65536.0f);
+        }
+    }
+}
+
+void synth_build_amp_env(synth_params_t *p, const float *m, float Fs)
+{
+    // convert main input times to sample number
+    fix attack_time = float_to_fix(m[1] * Fs);
+    fix decay_time = float_to_fix(m[3] * Fs);
+    fix sustain_time = float_to_fix(m[2] * Fs);
+    // and now get increments, linear and parabolic fit
+    fix decay_inc = div(max_amp, decay_time);
+
+    // stage lengths in whole samples for the ISR envelopes
+    p->amp.attack_inc = div(max_amp, attack_time);
+    p->amp.decay_inc = decay_inc;
+    p->amp.attack_len = fix_to_int(attack_time) + 1;
+    p->amp.sustain_len = fix_to_int(sustain_time);
+    p->amp.decay_len = fix_to_int(decay_time);
+    p->amp.quadratic = (m[9] != 1);
+    // change of the parabolic decay step per sample, 2*decay_inc/decay_time
+    // with DECAY_FRAC extra bits -- the only divide left for that curve
+    p->amp.quad_dd = (((long long)(decay_inc << 1)) << (12 + DECAY_FRAC)) / decay_time;
+}
+
+void synth_build_mod_env(synth_params_t *p, const float *m, float Fs)
+{
+    // fm modulation strength
+    fix max_mod_depth = float_to_fix(m[5] * 100000);
+
+    // convert modulation input times to sample number
+    fix mod_attack_time = float_to_fix(m[6] * Fs);
+    fix mod_decay_time = float_to_fix(m[8] * Fs);
+    fix mod_sustain_time = float_to_fix(m[7] * Fs);
+
+    // precomputing increments means that only add/subtract is needed
+    p->mod.attack_inc = div(max_mod_depth, mod_attack_time);
+    p->mod.decay_inc = div(max_mod_depth, mod_decay_time);
+    p->mod.attack_len = fix_to_int(mod_attack_time) + 1;
+    p->mod.sustain_len = fix_to_int(mod_sustain_time);
+    p->mod.decay_len = fix_to_int(mod_decay_time);
+    p->mod.quadratic = false;
+}
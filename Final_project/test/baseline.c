@@ -0,0 +1,166 @@
+// the pre voice pool renderer, see baseline.h
+#include <math.h>
+#include "baseline.h"
+
+// DDS variables
+static unsigned int mod_inc[NUM_KEYS], main_inc[NUM_KEYS];
+static unsigned int current_mod_inc[NUM_KEYS], current_main_inc[NUM_KEYS];
+static unsigned int mod_accum[NUM_KEYS], main_accum[NUM_KEYS];
+
+// amplitude paramters
+static fix max_mod_depth;
+static fix current_mod_depth[NUM_KEYS];
+static fix current_amp[NUM_KEYS];
+
+// timing in samples
+static fix attack_time, mod_attack_time;
+static fix decay_time, mod_decay_time;
+static fix sustain_time, mod_sustain_time;
+static fix note_time[NUM_KEYS];
+static fix attack_inc, decay_inc, mod_attack_inc, mod_decay_inc;
+static fix mod_wave[NUM_KEYS], main_wave[NUM_KEYS];
+
+static int note_start[NUM_KEYS], add_delay[NUM_KEYS];
+static bool pressed[NUM_KEYS], prev_pressed[NUM_KEYS];
+static int linear_dk;
+static int buffer_count;
+int old_buffer[OLD_MAX_VOICES];
+
+void old_init(const float *m, int num_voices)
+{
+    // 1/Fs in microseconds ~ 27.7kHz
+    float Fs = 1.0 / ((float)36 * 1e-6);
+    float Fmod = m[4];
+
+    buffer_count = num_voices;
+    for (int i = 0; i < OLD_MAX_VOICES; i++) old_buffer[i] = -1;
+    for (int i = 0; i < NUM_KEYS; i++) {
+        main_inc[i] = notes[i] * pow(2, 32) / Fs;
+        mod_inc[i] = Fmod * notes[i] * pow(2, 32) / Fs;
+        pressed[i] = prev_pressed[i] = false;
+        note_start[i] = false;
+        current_amp[i] = current_mod_depth[i] = 0;
+        main_wave[i] = mod_wave[i] = 0;
+        main_accum[i] = mod_accum[i] = 0;
+    }
+    max_mod_depth = float_to_fix(m[5] * 100000);
+    attack_time = float_to_fix(m[1] * Fs);
+    decay_time = float_to_fix(m[3] * Fs);
+    sustain_time = float_to_fix(m[2] * Fs);
+    attack_inc = div(max_amp, attack_time);
+    decay_inc = div(max_amp, decay_time);
+    mod_attack_time = float_to_fix(m[6] * Fs);
+    mod_decay_time = float_to_fix(m[8] * Fs);
+    mod_sustain_time = float_to_fix(m[7] * Fs);
+    mod_attack_inc = div(max_mod_depth, mod_attack_time);
+    mod_decay_inc = div(max_mod_depth, mod_decay_time);
+    linear_dk = (m[9] == 1);
+}
+
+// as protothread_readmux saw a key go down and then stay down
+void old_press(int key)
+{
+    prev_pressed[key] = pressed[key] = true;
+    current_main_inc[key] = main_inc[key];
+    current_mod_inc[key] = mod_inc[key];
+    note_start[key] = true;
+    old_add_note(key);
+}
+
+void old_release(int key)
+{
+    pressed[key] = prev_pressed[key] = false;
+}
+
+fix old_amp(int key)
+{
+    return current_amp[key];
+}
+
+uint16_t old_compute_sample(void)
+{
+    static int i;
+    for (int j = 0; j < buffer_count; j++) {
+        i = old_buffer[j];
+        if (i != -1) {
+        if (note_start[i]) {
+            note_start[i] = false;
+            current_amp[i] = attack_inc;
+            current_mod_depth[i] = mod_attack_inc;
+            note_time[i] = 0;
+            main_accum[i] = 0;
+            add_delay[i] = 0;
+        }
+        else if (pressed[i] && prev_pressed[i]) {
+            add_delay[i] += onefix;
+        }
+        if (current_amp[i] > 0) {
+            mod_accum[i] += current_mod_inc[i];
+            mod_wave[i] = sine_table[mod_accum[i] >> 24];
+            if (note_time[i] < (mod_attack_time + mod_decay_time + mod_sustain_time + add_delay[i])) {
+                current_mod_depth[i] = (note_time[i] <= mod_attack_time) ?
+                    current_mod_depth[i] + mod_attack_inc :
+                    (note_time[i] <= mod_attack_time + mod_sustain_time + add_delay[i]) ? current_mod_depth[i] :
+                    current_mod_depth[i] - mod_decay_inc;
+            }
+            else {
+                current_mod_depth[i] = 0;
+            }
+            main_accum[i] += current_main_inc[i] + (unsigned int)mul(mod_wave[i], current_mod_depth[i]);
+            main_wave[i] = sine_table[main_accum[i] >> 24];
+            if (note_time[i] < (attack_time + decay_time + sustain_time + add_delay[i])) {
+                if (note_time[i] <= attack_time) current_amp[i] += attack_inc;
+                else if (note_time[i] > attack_time + sustain_time + add_delay[i]) {
+                    if (linear_dk == 1) { current_amp[i] -= decay_inc; }
+                    else {
+                        current_amp[i] = current_amp[i] - (decay_inc << 1) +
+                            div(mul((decay_inc << 1), (note_time[i] - attack_time - sustain_time - add_delay[i])), decay_time);
+                    }
+                }
+            }
+            else {
+                current_amp[i] = 0;
+            }
+            main_wave[i] = mul(main_wave[i], current_amp[i]);
+            note_time[i] += onefix;
+        }
+        }
+    }
+
+    fix sum_waves = int_to_fix(0);
+    for (int i = 0; i < buffer_count; i++) {
+        int j = old_buffer[i];
+        if (j != -1) {
+            sum_waves += main_wave[j];
+        }
+    }
+    fix final_wave = div(sum_waves, int_to_fix(buffer_count));
+    return DAC_config_chan_A | ((fix_to_int(final_wave) + 2048) & 0xfff);
+}
+
+void old_add_note(int note)
+{
+    int index = -1;
+    for (int i = 0; i < buffer_count; i++) {
+        if (old_buffer[i] == note) {
+            index = i;
+        }
+    }
+    // not found: drop the oldest and add the note at the end, else move
+    // the note to the end
+    int next;
+    if (index == -1) {
+        for (int j = 0; j < buffer_count - 1; j++) {
+            next = old_buffer[j + 1];
+            old_buffer[j] = next;
+        }
+        old_buffer[buffer_count - 1] = note;
+    }
+    else {
+        for (int k = index; k < buffer_count - 1; k++) {
+            next = old_buffer[k + 1];
+            old_buffer[k] = next;
+        }
+        old_buffer[buffer_count - 1] = note;
+    }
+}
@@ -0,0 +1,33 @@
+/**
+ * The renderer before the voice pool, for comparison
+ *
+ * compute_sample() and add_note() as final_project.c had them: NUM_KEYS
+ * parallel arrays indexed through a buffer of the last keys played, the
+ * envelopes worked out from note_time every sample, and the sum divided
+ * by the buffer length. Only the SPI write is left out. The buffer
+ * length, BUFFER_COUNT there, is set at run time here.
+ */
+
+#ifndef BASELINE_H
+#define BASELINE_H
+
+#include "synth.h"
+
+#define OLD_MAX_VOICES 32
+
+// menu values m, num_voices buffer entries, all keys up
+void old_init(const float *m, int num_voices);
+// key down, and held until old_release()
+void old_press(int key);
+void old_release(int key);
+// the shift-based voice buffer update, newest key at the end
+void old_add_note(int note);
+// one sample, returns the channel A DAC word
+uint16_t old_compute_sample(void);
+
+// amplitude of key, s19x12
+fix old_amp(int key);
+// last key played at each buffer position, -1 if none
+extern int old_buffer[OLD_MAX_VOICES];
+
+#endif
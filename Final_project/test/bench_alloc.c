@@ -0,0 +1,60 @@
+// Note-on cost: the slot lists against the old shift-based add_note()
+// (baseline.c), with 8, 16 and 32 voices all in use. Each note is struck
+// and released half the voice count of notes later, the old buffer
+// shifting on every press and the lists stealing on every note-on.
+// synth.c is compiled into this file to reach note_on() and note_off()
+// without rendering around them.
+#include <stdio.h>
+#include "synth.c"
+#include "host.h"
+#include "baseline.h"
+
+#define NOTES 100000
+#define SEQ_LEN 4096
+
+static signed char seq[SEQ_LEN];
+
+static double old_note_ns(int num_voices)
+{
+    old_init(synth_presets[PRESET_PIANO], num_voices);
+    double t = host_now();
+    for (int i = 0; i < NOTES; i++) {
+        old_press(seq[i % SEQ_LEN]);
+        old_release(seq[(i + SEQ_LEN - num_voices / 2) % SEQ_LEN]);
+    }
+    return (host_now() - t) * 1e9 / NOTES;
+}
+
+static double note_ns(int num_voices)
+{
+    host_reset();
+    host_params(synth_presets[PRESET_PIANO]);
+    synth_set_polyphony(num_voices);
+    double t = host_now();
+    for (int i = 0; i < NOTES; i++) {
+        note_on(seq[i % SEQ_LEN], NOTE_SRC_KEYS);
+        note_off(seq[(i + SEQ_LEN - num_voices / 2) % SEQ_LEN]);
+    }
+    return (host_now() - t) * 1e9 / NOTES;
+}
+
+int main(void)
+{
+    static const int counts[] = { 8, 16, 32 };
+    srand(4760);
+    for (int i = 0; i < SEQ_LEN; i++) seq[i] = rand() % NUM_KEYS;
+
+    printf("note-on and note-off, ns per note, median of %d runs\n", HOST_RUNS);
+    printf("  voices  shift buffer  slot lists  speedup\n");
+    for (int i = 0; i < 3; i++) {
+        double old_ns[HOST_RUNS], ns[HOST_RUNS], ratio[HOST_RUNS];
+        for (int run = 0; run < HOST_RUNS; run++) {
+            old_ns[run] = old_note_ns(counts[i]);
+            ns[run] = note_ns(counts[i]);
+            ratio[run] = old_ns[run] / ns[run];
+        }
+        printf("  %6d  %12.1f  %10.1f  %6.2fx\n", counts[i], host_median(old_ns, HOST_RUNS),
+            host_median(ns, HOST_RUNS), host_median(ratio, HOST_RUNS));
+    }
+    return 0;
+}
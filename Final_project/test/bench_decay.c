@@ -0,0 +1,61 @@
+// Cost of the parabolic decay: 16 voices struck and released at once,
+// rendered through a 3 s decay with the linear and with the parabolic
+// curve, in the old renderer (a divide per voice-sample, baseline.c) and
+// in the current one (closed-form steps at the control rate). The
+// difference between the two curves is what the parabola costs.
+#include <stdio.h>
+#include "host.h"
+#include "baseline.h"
+
+#define VOICES 16
+
+static double old_decay_ns(const float *m)
+{
+    volatile uint16_t sink;
+    old_init(m, VOICES);
+    for (int v = 0; v < VOICES; v++) {
+        old_press(v);
+        old_release(v);
+    }
+    double t = host_now();
+    for (int n = 0; n < HOST_BLOCKS * AUDIO_BLOCK_SIZE; n++) sink = old_compute_sample();
+    (void)sink;
+    return (host_now() - t) * 1e9 / (HOST_BLOCKS * AUDIO_BLOCK_SIZE);
+}
+
+static double decay_ns(const float *m)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    host_reset();
+    host_params(m);
+    for (int v = 0; v < VOICES; v++) {
+        host_note(v, true);
+        host_note(v, false);
+    }
+    double t = host_now();
+    for (int b = 0; b < HOST_BLOCKS; b++) synth_render_block(out, AUDIO_BLOCK_SIZE);
+    return (host_now() - t) * 1e9 / (HOST_BLOCKS * AUDIO_BLOCK_SIZE);
+}
+
+int main(void)
+{
+    // sine preset with a long decay, menu[9] picks the curve
+    float lin[SYNTH_MENU_LENGTH] = { 3, .01, 0, 3, 3, 0, .01, 0, 3, 1, 1 };
+    float quad[SYNTH_MENU_LENGTH] = { 3, .01, 0, 3, 3, 0, .01, 0, 3, 0, 1 };
+    double t[4][HOST_RUNS];
+
+    for (int run = 0; run < HOST_RUNS; run++) {
+        t[0][run] = old_decay_ns(lin);
+        t[1][run] = old_decay_ns(quad);
+        t[2][run] = decay_ns(lin);
+        t[3][run] = decay_ns(quad);
+    }
+    double m[4];
+    for (int i = 0; i < 4; i++) m[i] = host_median(t[i], HOST_RUNS);
+
+    printf("decay, %d voices, ns per frame, median of %d runs\n", VOICES, HOST_RUNS);
+    printf("                 linear  parabolic  parabola per voice-sample\n");
+    printf("  per-sample div %6.1f  %9.1f  %6.2f\n", m[0], m[1], (m[1] - m[0]) / VOICES);
+    printf("  control rate   %6.1f  %9.1f  %6.2f\n", m[2], m[3], (m[3] - m[2]) / VOICES);
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Dual mode on the host: synth_helper_start() and synth_helper_wait()
+// hand the helper's voices to a second thread, the way the SIO FIFO
+// hands them to core 0, and the same held voices are rendered on one
+// thread and on two. Wall clock samples per second, since two threads
+// run at once. The two renders must also give the same output. With a
+// single host CPU the helper only gets turns when the rendering thread
+// yields, and dual mode measures the handoff's cost rather than a gain.
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "host.h"
+
+enum { JOB_IDLE, JOB_POSTED, JOB_DONE };
+static atomic_int job;
+static atomic_bool quit;
+
+static void *helper_main(void *arg)
+{
+    (void)arg;
+    for (;;) {
+        while (atomic_load_explicit(&job, memory_order_acquire) != JOB_POSTED) {
+            if (atomic_load_explicit(&quit, memory_order_relaxed)) return NULL;
+            sched_yield();
+        }
+        synth_helper_render();
+        atomic_store_explicit(&job, JOB_DONE, memory_order_release);
+    }
+}
+
+static void helper_start(void)
+{
+    atomic_store_explicit(&job, JOB_POSTED, memory_order_release);
+}
+
+static void helper_wait(void)
+{
+    while (atomic_load_explicit(&job, memory_order_acquire) != JOB_DONE) sched_yield();
+    atomic_store_explicit(&job, JOB_IDLE, memory_order_relaxed);
+}
+
+static double wall_now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// one run, samples per second, and a hash of the output
+static double render_rate(int num_voices, bool dual, uint32_t *hash)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    host_reset();
+    synth_set_dual(dual);
+    host_params(synth_presets[PRESET_PIANO]);
+    for (int v = 0; v < num_voices; v++) host_note(v % NUM_KEYS, true);
+    *hash = 0;
+    double t = wall_now();
+    for (int b = 0; b < HOST_BLOCKS; b++) {
+        synth_render_block(out, AUDIO_BLOCK_SIZE);
+        for (int i = 0; i < SYNTH_CHANNELS * AUDIO_BLOCK_SIZE; i++) *hash = *hash * 31 + out[i];
+    }
+    return HOST_BLOCKS * AUDIO_BLOCK_SIZE / (wall_now() - t);
+}
+
+int main(void)
+{
+    static const int counts[] = { 8, 16, 32 };
+    pthread_t helper;
+    int mismatches = 0;
+
+    synth_helper_start = helper_start;
+    synth_helper_wait = helper_wait;
+    pthread_create(&helper, NULL, helper_main, NULL);
+
+    printf("dual mode, piano preset, %ld host CPUs, Msamples/s, median of %d runs\n",
+        sysconf(_SC_NPROCESSORS_ONLN), HOST_RUNS);
+    printf("  voices  one thread  two threads  speedup\n");
+    for (int i = 0; i < 3; i++) {
+        double single[HOST_RUNS], dual[HOST_RUNS], ratio[HOST_RUNS];
+        for (int run = 0; run < HOST_RUNS; run++) {
+            uint32_t a, b;
+            single[run] = render_rate(counts[i], false, &a);
+            dual[run] = render_rate(counts[i], true, &b);
+            ratio[run] = dual[run] / single[run];
+            if (a != b) mismatches++;
+        }
+        printf("  %6d  %10.3f  %11.3f  %6.2fx\n", counts[i], host_median(single, HOST_RUNS) * 1e-6,
+            host_median(dual, HOST_RUNS) * 1e-6, host_median(ratio, HOST_RUNS));
+    }
+    printf("%d runs with different output on two threads\n", mismatches);
+
+    atomic_store(&quit, true);
+    pthread_join(helper, NULL);
+    return mismatches != 0;
+}
@@ -0,0 +1,61 @@
+// Voice kernel: the piano preset with a key struck every block and
+// released 16 blocks later, so voices are in every envelope stage at
+// once, in the old renderer (the stages found by comparing note_time
+// with their ends on every sample, baseline.c) and in this build's
+// stage machine. Built twice: bench_kernel steps the envelopes at the
+// control rate, bench_kernel_per_sample with SYNTH_ENV_SHIFT=0 steps
+// them every sample, as the stage machine first did.
+#include <stdio.h>
+#include "host.h"
+#include "baseline.h"
+
+#define KEYS 32
+#define HELD_BLOCKS 16
+
+static double old_kernel_ns(const float *m)
+{
+    volatile uint16_t sink;
+    old_init(m, KEYS);
+    double t = 0;
+    for (int b = 0; b < HOST_BLOCKS; b++) {
+        old_press(b % KEYS);
+        old_release((b + KEYS - HELD_BLOCKS) % KEYS);
+        double t0 = host_now();
+        for (int n = 0; n < AUDIO_BLOCK_SIZE; n++) sink = old_compute_sample();
+        t += host_now() - t0;
+    }
+    (void)sink;
+    return t * 1e9 / (HOST_BLOCKS * AUDIO_BLOCK_SIZE);
+}
+
+static double kernel_ns(const float *m)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    host_reset();
+    host_params(m);
+    double t = 0;
+    for (int b = 0; b < HOST_BLOCKS; b++) {
+        host_note(b % KEYS, true);
+        host_note((b + KEYS - HELD_BLOCKS) % KEYS, false);
+        double t0 = host_now();
+        synth_render_block(out, AUDIO_BLOCK_SIZE);
+        t += host_now() - t0;
+    }
+    return t * 1e9 / (HOST_BLOCKS * AUDIO_BLOCK_SIZE);
+}
+
+int main(void)
+{
+    const float *m = synth_presets[PRESET_PIANO];
+    double old_ns[HOST_RUNS], ns[HOST_RUNS], ratio[HOST_RUNS];
+    for (int run = 0; run < HOST_RUNS; run++) {
+        old_ns[run] = old_kernel_ns(m);
+        ns[run] = kernel_ns(m);
+        ratio[run] = old_ns[run] / ns[run];
+    }
+    printf("voice kernel, piano preset, SYNTH_ENV_SHIFT %d, ns per frame, median of %d runs\n",
+        SYNTH_ENV_SHIFT, HOST_RUNS);
+    printf("  comparisons %.1f  stage machine %.1f  speedup %.2fx\n",
+        host_median(old_ns, HOST_RUNS), host_median(ns, HOST_RUNS), host_median(ratio, HOST_RUNS));
+    return 0;
+}
@@ -0,0 +1,37 @@
+// The voice pool renderer against the old parallel-array one, baseline.c,
+// with 8, 16 and 32 held voices of the piano preset. The old renderer
+// makes one mono sample per call, the pool renders stereo blocks, so the
+// numbers are per output frame either way.
+#include <stdio.h>
+#include "host.h"
+#include "baseline.h"
+
+static double old_render_ns(const float *m, int num_voices)
+{
+    volatile uint16_t sink;
+    old_init(m, num_voices);
+    for (int v = 0; v < num_voices; v++) old_press(v % NUM_KEYS);
+    double t = host_now();
+    for (int n = 0; n < HOST_BLOCKS * AUDIO_BLOCK_SIZE; n++) sink = old_compute_sample();
+    (void)sink;
+    return (host_now() - t) * 1e9 / (HOST_BLOCKS * AUDIO_BLOCK_SIZE);
+}
+
+int main(void)
+{
+    static const int counts[] = { 8, 16, 32 };
+    const float *m = synth_presets[PRESET_PIANO];
+    printf("voice layout, piano preset, ns per frame, median of %d runs\n", HOST_RUNS);
+    printf("  voices  parallel arrays  voice pool  speedup\n");
+    for (int i = 0; i < 3; i++) {
+        double old_ns[HOST_RUNS], ns[HOST_RUNS], ratio[HOST_RUNS];
+        for (int run = 0; run < HOST_RUNS; run++) {
+            old_ns[run] = old_render_ns(m, counts[i]);
+            ns[run] = host_render_ns(m, counts[i]);
+            ratio[run] = old_ns[run] / ns[run];
+        }
+        printf("  %6d  %15.1f  %10.1f  %6.2fx\n", counts[i], host_median(old_ns, HOST_RUNS),
+            host_median(ns, HOST_RUNS), host_median(ratio, HOST_RUNS));
+    }
+    return 0;
+}
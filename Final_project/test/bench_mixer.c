@@ -0,0 +1,151 @@
+// The mixer against the old one, which divided the sum of the voices by
+// the voice count, 8, every sample: noise against an exact mix in double
+// precision and time per frame. N full-level voices of sines at random
+// pitches and phases are mixed, and each mixer's output is compared with
+// the same sum scaled by its own gain, for the gain table put through the
+// tanh curve soft_clip is made from, so the noise is what the fixed point
+// arithmetic and the table add. How often the clipper is in use, and how
+// far the peaks go, are printed next to it. synth.c is compiled into this
+// file to reach mix_block().
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "synth.c"
+#include "host.h"
+
+#define FRAMES (HOST_BLOCKS * AUDIO_BLOCK_SIZE)
+// the old code's voice count, the divisor of every sample
+#define OLD_VOICES 8
+// of gen-tables.py
+#define DAC_FULL_SCALE 2047
+
+static fix sums[FRAMES];
+static double exact[FRAMES];
+static fix zero[SYNTH_CHANNELS][AUDIO_BLOCK_SIZE];
+
+// n voices at max_amp, the sum both as the s19x12 the voices add up to
+// and exact
+static void make_sums(int n)
+{
+    double inc[SYNTH_MAX_VOICES], phase[SYNTH_MAX_VOICES];
+    for (int v = 0; v < n; v++) {
+        inc[v] = 2 * M_PI * notes[rand() % NUM_KEYS] / HOST_RATE;
+        phase[v] = 2 * M_PI * rand() / RAND_MAX;
+    }
+    for (int i = 0; i < FRAMES; i++) {
+        exact[i] = 0;
+        sums[i] = 0;
+        for (int v = 0; v < n; v++) {
+            double x = fix_to_float(max_amp) * sin(phase[v] + inc[v] * i);
+            exact[i] += x;
+            sums[i] += float_to_fix(x);
+        }
+    }
+}
+
+// the curve the soft_clip table samples
+static double exact_limit(double x)
+{
+    double a = fabs(x), span = DAC_FULL_SCALE - SOFT_CLIP_KNEE;
+    if (a > SOFT_CLIP_KNEE) a = SOFT_CLIP_KNEE + span * tanh((a - SOFT_CLIP_KNEE) / span);
+    return (x < 0) ? -a : a;
+}
+
+static int old_mix(fix sum)
+{
+    fix final_wave = div(sum, int_to_fix(OLD_VOICES));
+    return (fix_to_int(final_wave) + 2048) & 0xfff;
+}
+
+// signal to noise in dB, and the peak in DAC units
+static double old_snr(int *peak)
+{
+    double s = 0, e = 0;
+    *peak = 0;
+    for (int i = 0; i < FRAMES; i++) {
+        int y = old_mix(sums[i]) - 2048;
+        double x = exact[i] / OLD_VOICES;
+        s += x * x;
+        e += (y - x) * (y - x);
+        if (abs(y) > *peak) *peak = abs(y);
+    }
+    return 10 * log10(s / e);
+}
+
+static double new_snr(int gain, int *peak, double *clipped)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    fix block[SYNTH_CHANNELS][AUDIO_BLOCK_SIZE];
+    double s = 0, e = 0;
+    int over = 0;
+    *peak = 0;
+    for (int b = 0; b < HOST_BLOCKS; b++) {
+        for (int n = 0; n < AUDIO_BLOCK_SIZE; n++) block[0][n] = block[1][n] = sums[b * AUDIO_BLOCK_SIZE + n];
+        mix_block(out, block, zero, AUDIO_BLOCK_SIZE, gain);
+        for (int n = 0; n < AUDIO_BLOCK_SIZE; n++) {
+            int y = (out[2 * n] & 0xfff) - 2048;
+            double x = exact[b * AUDIO_BLOCK_SIZE + n] * gain / 1024;
+            if (fabs(x) > SOFT_CLIP_KNEE) over++;
+            x = exact_limit(x);
+            s += x * x;
+            e += (y - x) * (y - x);
+            if (abs(y) > *peak) *peak = abs(y);
+        }
+    }
+    *clipped = 100.0 * over / FRAMES;
+    return 10 * log10(s / e);
+}
+
+static double old_ns(void)
+{
+    volatile int sink;
+    double t = host_now();
+    for (int i = 0; i < FRAMES; i++) sink = old_mix(sums[i]);
+    (void)sink;
+    return (host_now() - t) * 1e9 / FRAMES;
+}
+
+// both channels, as the old code made one
+static double new_ns(int gain)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    fix (*block)[AUDIO_BLOCK_SIZE] = (fix (*)[AUDIO_BLOCK_SIZE])sums;
+    double t = host_now();
+    for (int b = 0; b < HOST_BLOCKS / SYNTH_CHANNELS; b++) {
+        mix_block(out, block + b * SYNTH_CHANNELS, zero, AUDIO_BLOCK_SIZE, gain);
+        __asm__ volatile("" : : "r"(out) : "memory");
+    }
+    return (host_now() - t) * 1e9 / (HOST_BLOCKS / SYNTH_CHANNELS * AUDIO_BLOCK_SIZE);
+}
+
+int main(void)
+{
+    static const int counts[] = { 1, 2, 4, 8, 16, 32 };
+    srand(1304);
+    printf("mixer, N full-level sines, SNR against the exact mix, peak of %d\n", DAC_FULL_SCALE);
+    printf("  voices  divide by %d: SNR    peak  gain table: SNR    peak  over knee\n", OLD_VOICES);
+    for (int i = 0; i < 6; i++) {
+        int n = counts[i], old_peak, peak;
+        double clipped;
+        make_sums(n);
+        double snr = new_snr(mix_gain[n], &peak, &clipped);
+        if (n <= OLD_VOICES) {
+            double o = old_snr(&old_peak);
+            printf("  %6d  %13.1f dB  %5d  %13.1f dB  %5d  %8.1f%%\n", n, o, old_peak, snr, peak, clipped);
+        }
+        else {
+            printf("  %6d  %16s  %5s  %13.1f dB  %5d  %8.1f%%\n", n, "-", "-", snr, peak, clipped);
+        }
+    }
+
+    make_sums(OLD_VOICES);
+    double o[HOST_RUNS], t[HOST_RUNS], ratio[HOST_RUNS];
+    for (int run = 0; run < HOST_RUNS; run++) {
+        o[run] = old_ns();
+        t[run] = new_ns(mix_gain[OLD_VOICES]);
+        ratio[run] = o[run] / t[run];
+    }
+    printf("ns per frame, median of %d runs: divide %.2f, gain table %.2f (both channels), %.2fx\n",
+        HOST_RUNS, host_median(o, HOST_RUNS), host_median(t, HOST_RUNS), host_median(ratio, HOST_RUNS));
+    return 0;
+}
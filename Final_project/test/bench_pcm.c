@@ -0,0 +1,49 @@
+// Sample playback against FM, each kind on its own: ns per voice-sample
+// of the kernel render_voices() picks for 16 held keys of the piano
+// preset, played by FM, by the sine preset's bare oscillator and from
+// the PCM zones. On the device synth_voice_cycles(VOICE_PCM) is the
+// same figure, from blocks of sampled voices. synth.c is compiled into
+// this file to reach the kernels.
+#include <stdio.h>
+#include "synth.c"
+#include "host.h"
+
+#define KEYS 16
+
+static fix sum[SYNTH_CHANNELS][AUDIO_BLOCK_SIZE];
+
+static double kind_ns(const float *m, bool pcm)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    host_reset();
+    host_params(m);
+    host_pcm(pcm);
+    for (int k = 0; k < KEYS; k++) host_note(k * 3, true);
+    // starts the voices and their envelopes
+    synth_render_block(out, AUDIO_BLOCK_SIZE);
+    const synth_params_t *p = live_params;
+    double t = host_now();
+    for (int b = 0; b < HOST_BLOCKS; b++) {
+        for (uint32_t mask = active_voices; mask; mask &= mask - 1) {
+            voice_t *v = &voices[__builtin_ctz(mask)];
+            (v->zone ? pcm_kernels[p->amp.quadratic] : voice_kernels[0][p->fm][p->amp.quadratic])
+                (v, sum[0], sum[1], AUDIO_BLOCK_SIZE, p);
+        }
+        __asm__ volatile("" : : "r"(sum) : "memory");
+    }
+    return (host_now() - t) * 1e9 / (HOST_BLOCKS * AUDIO_BLOCK_SIZE * KEYS);
+}
+
+int main(void)
+{
+    double fm[HOST_RUNS], sine[HOST_RUNS], pcm[HOST_RUNS];
+    for (int run = 0; run < HOST_RUNS; run++) {
+        fm[run] = kind_ns(synth_presets[PRESET_PIANO], false);
+        sine[run] = kind_ns(synth_presets[PRESET_SINE], false);
+        pcm[run] = kind_ns(synth_presets[PRESET_PIANO], true);
+    }
+    printf("voice kinds, %d held keys, ns per voice-sample, median of %d runs\n", KEYS, HOST_RUNS);
+    printf("  FM (piano) %.2f  sine %.2f  PCM %.2f\n", host_median(fm, HOST_RUNS),
+        host_median(sine, HOST_RUNS), host_median(pcm, HOST_RUNS));
+    return 0;
+}
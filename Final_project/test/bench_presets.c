@@ -0,0 +1,58 @@
+// Voice kernels per preset: the kernel render_voices() picks for each
+// instrument button against the general one, table oscillator with FM
+// and the parabolic decay, which does every preset's work the way the
+// single render loop did. 16 held keys of each preset, the voices run
+// straight through their kernel so the time is the kernel's alone. The
+// harp and the piano get the general kernel either way, and show the
+// noise of the measurement.
+// synth.c is compiled into this file to reach the kernels.
+#include <stdio.h>
+#include "synth.c"
+#include "host.h"
+
+#define KEYS 16
+
+static fix sum[SYNTH_CHANNELS][AUDIO_BLOCK_SIZE];
+
+static double preset_ns(const float *m, voice_kernel_t kernel)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    host_reset();
+    host_params(m);
+    for (int k = 0; k < KEYS; k++) host_note(k, true);
+    // starts the voices and their envelopes
+    synth_render_block(out, AUDIO_BLOCK_SIZE);
+    const synth_params_t *p = live_params;
+    double t = host_now();
+    for (int b = 0; b < HOST_BLOCKS; b++) {
+        for (uint32_t mask = active_voices; mask; mask &= mask - 1) {
+            kernel(&voices[__builtin_ctz(mask)], sum[0], sum[1], AUDIO_BLOCK_SIZE, p);
+        }
+        __asm__ volatile("" : : "r"(sum) : "memory");
+    }
+    return (host_now() - t) * 1e9 / (HOST_BLOCKS * AUDIO_BLOCK_SIZE * KEYS);
+}
+
+int main(void)
+{
+    printf("voice kernels per preset, ns per voice-sample, median of %d runs\n", HOST_RUNS);
+    printf("  preset  FM  decay      general  specialized  speedup\n");
+    for (int i = 0; i < NUM_PRESETS; i++) {
+        const float *m = synth_presets[i];
+        host_params(m);
+        const synth_params_t *p = live_params;
+        voice_kernel_t kernel = voice_kernels[0][p->fm][p->amp.quadratic];
+        double gen[HOST_RUNS], spec[HOST_RUNS], ratio[HOST_RUNS];
+        for (int run = 0; run < HOST_RUNS; run++) {
+            // either goes first every other run
+            if (run & 1) spec[run] = preset_ns(m, kernel);
+            gen[run] = preset_ns(m, voice_table_fm_quad);
+            if (!(run & 1)) spec[run] = preset_ns(m, kernel);
+            ratio[run] = gen[run] / spec[run];
+        }
+        printf("  %-6s  %-3s %-9s  %7.2f  %11.2f  %6.2fx\n", host_preset_names[i], p->fm ? "on" : "off",
+            p->amp.quadratic ? "parabolic" : "linear", host_median(gen, HOST_RUNS),
+            host_median(spec, HOST_RUNS), host_median(ratio, HOST_RUNS));
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+// Render throughput on the host: output frames per second with 8, 16
+// and 32 held voices of the piano preset.
+#include <stdio.h>
+#include "host.h"
+
+int main(void)
+{
+    static const int counts[] = { 8, 16, 32 };
+    printf("render, piano preset, %d frame blocks, median of %d runs\n", AUDIO_BLOCK_SIZE, HOST_RUNS);
+    for (int i = 0; i < 3; i++) {
+        double ns[HOST_RUNS];
+        for (int run = 0; run < HOST_RUNS; run++) ns[run] = host_render_ns(synth_presets[PRESET_PIANO], counts[i]);
+        double t = host_median(ns, HOST_RUNS);
+        printf("  %2d voices: %8.3f Mframes/s  %7.1f ns/frame  %6.1fx real time at %d Hz\n",
+            counts[i], 1e3 / t, t, 1e9 / t / HOST_RATE, HOST_RATE);
+    }
+    return 0;
+}
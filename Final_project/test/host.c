@@ -0,0 +1,75 @@
+// host harness, see host.h
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "host.h"
+
+const char *const host_preset_names[NUM_PRESETS] = { "harp", "bells", "sine", "piano" };
+
+// the menu values of the last host_params(), for host_pcm()
+static float host_menu[SYNTH_MENU_LENGTH];
+
+void host_reset(void)
+{
+    memset(voices, 0, sizeof(voices));
+    memset(note_queues, 0, sizeof(note_queues));
+    synth_samples = 0;
+    synth_set_budget(0);
+    synth_set_polyphony(SYNTH_MAX_VOICES);
+    synth_init();
+}
+
+void host_params(const float *menu)
+{
+    synth_params_t *p = synth_params_edit();
+    for (int i = 0; i < SYNTH_MENU_LENGTH; i++) host_menu[i] = menu[i];
+    synth_menu_clamp(host_menu);
+    synth_build_pitch(p, host_menu, HOST_RATE, HOST_RATE, false, SYNTH_TABLE_BASE_NOTE);
+    synth_build_amp_env(p, host_menu, HOST_RATE);
+    synth_build_mod_env(p, host_menu, HOST_RATE);
+    synth_publish_params(p);
+}
+
+void host_pcm(bool on)
+{
+    synth_params_t *p = synth_params_edit();
+    synth_build_pitch(p, host_menu, HOST_RATE, HOST_RATE, on, SYNTH_TABLE_BASE_NOTE);
+    synth_publish_params(p);
+}
+
+void host_note(int key, bool on)
+{
+    synth_post_note(NOTE_SRC_KEYS, key, on, synth_samples);
+}
+
+double host_render_ns(const float *m, int num_voices)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    host_reset();
+    host_params(m);
+    // held keys stay at full level, so every voice sounds throughout
+    for (int v = 0; v < num_voices; v++) host_note(v % NUM_KEYS, true);
+    synth_render_block(out, AUDIO_BLOCK_SIZE);
+    double t = host_now();
+    for (int b = 0; b < HOST_BLOCKS; b++) synth_render_block(out, AUDIO_BLOCK_SIZE);
+    return (host_now() - t) * 1e9 / (HOST_BLOCKS * AUDIO_BLOCK_SIZE);
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+double host_median(double *x, int n)
+{
+    qsort(x, n, sizeof(double), cmp_double);
+    return (n & 1) ? x[n / 2] : (x[n / 2 - 1] + x[n / 2]) / 2;
+}
+
+double host_now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
@@ -0,0 +1,45 @@
+/**
+ * Host harness for the tests and benchmarks
+ *
+ * Builds parameter blocks from menu values with protothread_FM's own
+ * builder (synth_params.c), resets the synth between runs and times code
+ * with the host clock.
+ * Host times compare two versions of the code on the same machine; what
+ * a block costs on the RP2040 is measured there by synth_block_timing().
+ */
+
+#ifndef HOST_H
+#define HOST_H
+
+#include "synth.h"
+
+// the rate of note_inc_table[0], the old 36 uSec alarm period
+#define HOST_RATE 27778
+
+// names of synth_presets
+extern const char *const host_preset_names[NUM_PRESETS];
+
+// clear every voice, queue and counter, as at boot
+void host_reset(void);
+// build and publish the parameter block for menu values m at HOST_RATE,
+// as protothread_FM does
+void host_params(const float *m);
+// sample playback for the notes struck from now on, zones picked as
+// protothread_FM does, or FM again; after host_params()
+void host_pcm(bool on);
+// start or release key on the keys' queue at the next sample
+void host_note(int key, bool on);
+// One benchmark run renders HOST_BLOCKS blocks. The host's clock rate
+// wanders, so benchmarks take HOST_RUNS short runs, alternate the code
+// versions they compare between runs and report medians.
+#define HOST_BLOCKS 500
+#define HOST_RUNS 31
+// ns per frame synth_render_block() takes with num_voices held keys of
+// menu values m, one run
+double host_render_ns(const float *m, int num_voices);
+// median of x[0..n-1], sorts x
+double host_median(double *x, int n);
+// seconds of this thread's CPU time
+double host_now(void);
+
+#endif
@@ -0,0 +1,117 @@
+// Voice allocator stress test: random note-ons and note-offs a random
+// number of samples apart, with the polyphony and the envelope lengths
+// changed every few hundred events so voices run out, get stolen and get
+// reused in every order. After every event the free/released/held lists
+// must be intact and the slot a note-on took must be the one the
+// stealing rules pick.
+#include <stdio.h>
+#include <stdlib.h>
+#include "host.h"
+
+#define EVENTS 100000
+// most samples between events
+#define MAX_GAP 128
+#define PHASE_EVENTS 500
+
+static int failures;
+
+#define CHECK(cond, ...) do { if (!(cond)) { \
+    if (failures++ < 10) { printf("event %d: ", event); printf(__VA_ARGS__); printf("\n"); } \
+    } } while (0)
+
+// first slot of list, -1 if empty
+static int list_head(int list)
+{
+    for (int s = 0; s < SYNTH_MAX_VOICES; s++) {
+        if (voices[s].list == list && voices[s].prev < 0) return s;
+    }
+    return -1;
+}
+
+static void check_lists(int event)
+{
+    int on_lists = 0;
+    for (int l = 0; l < NUM_VOICE_LISTS; l++) {
+        int members = 0, heads = 0, walked = 0;
+        for (int s = 0; s < SYNTH_MAX_VOICES; s++) {
+            if (voices[s].list != l) continue;
+            members++;
+            if (voices[s].prev < 0) heads++;
+        }
+        CHECK(members == 0 || heads == 1, "list %d has %d heads", l, heads);
+        for (int s = list_head(l), prev = -1; s >= 0 && walked <= SYNTH_MAX_VOICES; s = voices[s].next) {
+            CHECK(voices[s].list == l, "slot %d linked into list %d is on %d", s, l, voices[s].list);
+            CHECK(voices[s].prev == prev, "slot %d prev %d, expected %d", s, voices[s].prev, prev);
+            prev = s;
+            walked++;
+        }
+        CHECK(walked == members, "list %d: walked %d of %d slots", l, walked, members);
+        on_lists += members;
+    }
+    CHECK(on_lists == SYNTH_MAX_VOICES, "%d slots on lists", on_lists);
+
+    for (int s = 0; s < SYNTH_MAX_VOICES; s++) {
+        voice_t *v = &voices[s];
+        bool active = (active_voices >> s) & 1;
+        if (v->list == VOICES_FREE) {
+            CHECK(!active && v->key < 0, "free slot %d active %d key %d", s, active, v->key);
+        }
+        else {
+            CHECK(active, "slot %d on list %d is not active", s, v->list);
+            CHECK(v->key >= 0 && key_voice[v->key] == s, "slot %d key %d maps to %d", s, v->key,
+                v->key >= 0 ? key_voice[v->key] : -1);
+            CHECK(v->held == (v->list == VOICES_HELD), "slot %d held %d on list %d", s, v->held, v->list);
+        }
+    }
+    for (int k = 0; k < NUM_KEYS; k++) {
+        if (key_voice[k] >= 0) CHECK(voices[key_voice[k]].key == k, "key %d maps to slot %d playing %d",
+            k, key_voice[k], voices[key_voice[k]].key);
+    }
+}
+
+int main(void)
+{
+    // short notes that free themselves, and long ones that get stolen
+    float shapes[2][SYNTH_MENU_LENGTH] = {
+        { 3, .001, 0, .002, 3, .25, .001, 0, .002, 0, 1 },
+        { 3, .01, .3, 2, 3, .25, .01, .1, 2, 1, 1 },
+    };
+    uint16_t out[SYNTH_CHANNELS * MAX_GAP];
+    int steals = 0, frees = 0;
+
+    srand(4760);
+    host_reset();
+    host_params(shapes[0]);
+    for (int event = 0; event < EVENTS; event++) {
+        if (event % PHASE_EVENTS == 0) {
+            synth_set_polyphony(1 + rand() % SYNTH_MAX_VOICES);
+            host_params(shapes[rand() & 1]);
+        }
+        int key = rand() % NUM_KEYS;
+        bool on = rand() & 1;
+        int expect = key_voice[key];
+        if (on && expect < 0) {
+            // a free slot while under the limit, else the oldest released
+            // voice, else the oldest held one
+            expect = list_head(VOICES_FREE);
+            if (expect < 0 || __builtin_popcount(active_voices) >= voice_limit) {
+                expect = list_head(VOICES_RELEASED);
+                if (expect < 0) expect = list_head(VOICES_HELD);
+                steals++;
+            }
+            else {
+                frees++;
+            }
+        }
+        host_note(key, on);
+        // the event lands on the first sample, check before the voice can end
+        synth_render_block(out, 1);
+        if (on) CHECK(key_voice[key] == expect, "key %d took slot %d, expected %d", key, key_voice[key], expect);
+        check_lists(event);
+        synth_render_block(out, rand() % MAX_GAP);
+        check_lists(event);
+    }
+    printf("%d events, %d note-ons from the free list, %d steals, %d failures\n",
+        EVENTS, frees, steals, failures);
+    return failures != 0;
+}
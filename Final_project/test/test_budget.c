@@ -0,0 +1,44 @@
+// Per-kind voice costs: block times made up from a fixed cost per
+// voice-sample of each kind are fed to synth_block_timing(), first for
+// FM voices alone and then with sampled voices struck on top, and the
+// two averages synth_voice_cycles() keeps must settle on their own
+// costs rather than on one blend of both.
+#include <stdio.h>
+#include <stdlib.h>
+#include "host.h"
+
+#define FM_CYCLES 230
+#define PCM_CYCLES 410
+#define KEYS 4
+#define BLOCKS 100
+
+static void run(int fm_voices, int pcm_voices)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    for (int b = 0; b < BLOCKS; b++) {
+        synth_render_block(out, AUDIO_BLOCK_SIZE);
+        synth_block_timing(AUDIO_BLOCK_SIZE * (SYNTH_CYCLES_PER_SAMPLE + fm_voices * FM_CYCLES +
+            pcm_voices * PCM_CYCLES), AUDIO_BLOCK_SIZE);
+    }
+}
+
+static bool near(uint32_t got, int want)
+{
+    return abs((int)got - want) <= want / 50;
+}
+
+int main(void)
+{
+    host_reset();
+    host_params(synth_presets[PRESET_SINE]);
+    for (int k = 0; k < KEYS; k++) host_note(k, true);
+    run(KEYS, 0);
+    host_pcm(true);
+    for (int k = 0; k < KEYS; k++) host_note(20 + k, true);
+    run(KEYS, KEYS);
+    uint32_t fm = synth_voice_cycles(VOICE_FM), pcm = synth_voice_cycles(VOICE_PCM);
+    bool ok = near(fm, FM_CYCLES) && near(pcm, PCM_CYCLES);
+    printf("cycles per voice-sample: FM %lu of %d, PCM %lu of %d  %s\n", (unsigned long)fm, FM_CYCLES,
+        (unsigned long)pcm, PCM_CYCLES, ok ? "ok" : "FAIL");
+    return !ok;
+}
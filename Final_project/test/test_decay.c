@@ -0,0 +1,81 @@
+// The parabolic decay by second differences, stepped at the control rate,
+// against the curve the old code meant, amp -= 2*decay_inc*(1 - t/decay_time)
+// every sample, worked out in double precision. The old fixed point
+// version with a divide every sample (baseline.c) is measured against
+// the same curve for comparison. A note is struck and released at once
+// and the amplitude is compared sample by sample through the decay for
+// a range of decay times. Left out are the attack, which the control
+// rate ramp trails by up to ENV_CONTROL_SAMPLES by design, and the last
+// control periods, where the old curve dropped to 0 in one step from the
+// attack's overshoot and the new one ramps down. The stage machine
+// starts the decay on the sample after attack_len, up to one sample after
+// the old comparison did, so either sample's value of the curve counts.
+// Decays much under .02 s last only a few control periods, which the
+// ramps follow less closely.
+#include <stdio.h>
+#include <math.h>
+#include "host.h"
+#include "baseline.h"
+
+// largest difference allowed, in DAC units of the 1000 full scale
+#define TOLERANCE 5.0
+
+static bool check(float decay)
+{
+    // sine preset, no sustain, parabolic decay
+    float m[SYNTH_MENU_LENGTH] = { 3, .001, 0, decay, 3, 0, .001, 0, decay, 0, 1 };
+    const int key = 20;
+    uint16_t out[SYNTH_CHANNELS];
+    double new_err = 0, old_err = 0;
+
+    host_reset();
+    host_params(m);
+    host_note(key, true);
+    host_note(key, false);
+    old_init(m, 8);
+    old_press(key);
+    old_release(key);
+
+    // the old code's stage times and decay increment, see old_init()
+    float Fs = 1.0 / ((float)36 * 1e-6);
+    double attack = fix_to_float(float_to_fix(m[1] * Fs));
+    fix decay_time = float_to_fix(m[3] * Fs);
+    double d = fix_to_float(div(max_amp, decay_time));
+    double len = fix_to_float(decay_time);
+
+    double ideal = 0, prev = 0;
+    bool decaying = false;
+    int end = (int)(attack + len) - 2 * ENV_CONTROL_SAMPLES;
+    for (int n = 0; n < end; n++) {
+        synth_render_block(out, 1);
+        old_compute_sample();
+        if (n <= attack) continue;
+        // the curve starts from the level the attack reached
+        if (!decaying) {
+            decaying = true;
+            ideal = fix_to_float(old_amp(key));
+            continue;
+        }
+        prev = ideal;
+        ideal -= 2 * d * (1 - (n - attack) / len);
+        if (n < attack + ENV_CONTROL_SAMPLES) continue;
+        int slot = key_voice[key];
+        double amp = (slot >= 0) ? fix_to_float(voices[slot].amp_out) : 0;
+        new_err = fmax(new_err, fmin(fabs(amp - ideal), fabs(amp - prev)));
+        old_err = fmax(old_err, fabs(fix_to_float(old_amp(key)) - ideal));
+    }
+    bool ok = new_err <= TOLERANCE;
+    printf("  decay %5.3f s: %6.3f  (per-sample divide %6.3f)  %s\n", decay, new_err, old_err, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(void)
+{
+    static const float decays[] = { .02, .05, .4, .5, .99, 3, 5 };
+    int failed = 0;
+    printf("parabolic decay, largest difference from the exact curve, of 1000\n");
+    for (int i = 0; i < (int)(sizeof(decays) / sizeof(decays[0])); i++) {
+        if (!check(decays[i])) failed++;
+    }
+    return failed != 0;
+}
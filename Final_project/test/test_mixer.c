@@ -0,0 +1,73 @@
+// The mixer's levels: one voice at full level, held and released, must
+// stay at or under SOFT_CLIP_KNEE on both channels for every preset and
+// the shortest attack the menu allows, so a solo note is never clipped.
+// The clipper itself must pass samples under the knee untouched, rise
+// by at most one DAC step per input step above it, stay symmetric and
+// never reach past full scale. synth.c is compiled into this file to
+// reach soft_limit().
+#include <stdio.h>
+#include <stdlib.h>
+#include "synth.c"
+#include "host.h"
+
+#define HOLD_SAMPLES (2 * HOST_RATE)
+#define RELEASE_SAMPLES (3 * HOST_RATE)
+
+static int failures;
+
+// highest distance from mid-scale of one note of menu values m
+static int solo_peak(const float *m, int key)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    int peak = 0;
+    host_reset();
+    host_params(m);
+    host_note(key, true);
+    for (int n = 0; n < HOLD_SAMPLES + RELEASE_SAMPLES; n += AUDIO_BLOCK_SIZE) {
+        if (n == HOLD_SAMPLES) host_note(key, false);
+        synth_render_block(out, AUDIO_BLOCK_SIZE);
+        for (int i = 0; i < SYNTH_CHANNELS * AUDIO_BLOCK_SIZE; i++) {
+            int y = abs((out[i] & 0xfff) - 2048);
+            if (y > peak) peak = y;
+        }
+    }
+    return peak;
+}
+
+static void check_levels(const char *name, const float *m)
+{
+    static const int keys[] = { 0, 13, 27, 40, 52, NUM_KEYS - 1 };
+    int peak = 0;
+    for (int i = 0; i < (int)(sizeof(keys) / sizeof(keys[0])); i++) {
+        int p = solo_peak(m, keys[i]);
+        if (p > peak) peak = p;
+    }
+    bool ok = peak <= SOFT_CLIP_KNEE;
+    if (!ok) failures++;
+    printf("  %-14s peak %4d of knee %d  %s\n", name, peak, SOFT_CLIP_KNEE, ok ? "ok" : "FAIL");
+}
+
+static void check_clipper(void)
+{
+    int prev = soft_limit(0), bad = 0;
+    for (int x = 1; x < 4 * 2048; x++) {
+        int y = soft_limit(x);
+        if (x < SOFT_CLIP_KNEE && y != x) bad++;
+        if (y < prev || y > prev + 1) bad++;
+        if (y > 2047 || soft_limit(-x) != -y) bad++;
+        prev = y;
+    }
+    if (bad) failures++;
+    printf("  soft clipper: %d bad steps, tops out at %d  %s\n", bad, prev, bad ? "FAIL" : "ok");
+}
+
+int main(void)
+{
+    // a held sine at the shortest attack, the largest overshoot
+    float fastest[SYNTH_MENU_LENGTH] = { 3, .001, 1, 3, 3, 0, .001, 0, 3, 0, 1 };
+    printf("mixer levels, one voice\n");
+    for (int p = 0; p < NUM_PRESETS; p++) check_levels(host_preset_names[p], synth_presets[p]);
+    check_levels("shortest attack", fastest);
+    check_clipper();
+    return failures != 0;
+}
@@ -0,0 +1,233 @@
+// Song timing through the sequencer. Every song is played against a
+// simulated clock: the render ISR takes a block every AUDIO_BLOCK_SIZE
+// samples and the song thread wakes every 1000-1300 us, as the scheduler
+// runs it, and calls seq_pump() with the note_time() of that moment. Each
+// event is taken off the queue as posted and the sample the ISR applies
+// it on, its stamp or the next block if that is already past, is compared
+// with the sample its song time lands on from the start. With the thread
+// on time every event must land exactly. With the thread stalled now and
+// then for longer than SEQ_LOOKAHEAD the events due in the stall play
+// late, none early, and the song is back on time at the next wakeup. A change of
+// output rate halfway re-times the rest of the song from that sample.
+// Last, seq_stop() must release the song's voices and leave a key the
+// player holds sounding, and with the song queue full it must refuse,
+// still playing, rather than drop the release.
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "host.h"
+#include "sequencer.h"
+
+#define X(id) extern const song_t song_##id;
+SEQUENCER_SONGS
+#undef X
+#define X(id) &song_##id,
+static const song_t *const test_songs[] = { SEQUENCER_SONGS };
+#undef X
+#define NUM_SONGS ((int)(sizeof(test_songs) / sizeof(test_songs[0])))
+
+// output rate after the change
+#define NEW_RATE 48000
+// how long a stall lasts and its chance on each wakeup
+#define STALL_US 250000
+#define STALL_P .002
+
+static int rate;
+static double block_start;  // time the block being played out began
+
+static double urand(void)
+{
+    return rand() / (RAND_MAX + 1.0);
+}
+
+// note_time() at time t: the render position plus the samples played out
+static uint32_t sim_note_time(double t)
+{
+    uint32_t played = (uint32_t)((t - block_start) * rate / 1e6);
+    return synth_samples + (played < AUDIO_BLOCK_SIZE ? played : AUDIO_BLOCK_SIZE - 1);
+}
+
+typedef struct timing {
+    long events;
+    long off;       // events off time posted by an on time wakeup
+    long stalled;   // events late after a stall
+    long max_late, max_early;
+} timing_t;
+
+static timing_t play(const song_t *song, double stall_p, bool rate_change)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    note_queue_t *q = &note_queues[NOTE_SRC_SONG];
+    timing_t tm = { 0 };
+    sequencer_t seq;
+    song_reader_t r;
+    song_event_t e;
+    double t = 0, wake = 0;
+    bool posted_all = false, stall = false;
+    uint32_t seen = 0;
+    uint64_t us = 0;
+
+    host_reset();
+    host_params(synth_presets[PRESET_PIANO]);
+    rate = HOST_RATE;
+    block_start = 0;
+    seq_start(&seq, song, sim_note_time(0), rate, SYNTH_TABLE_BASE_NOTE);
+    song_open(song, &r);
+    // the song time anchor_us plays at sample anchor, at rate
+    double anchor_us = 0;
+    uint32_t anchor = seq.start;
+
+    while (!posted_all || q->tail != q->head) {
+        double render = block_start + AUDIO_BLOCK_SIZE * 1e6 / rate;
+        if (posted_all || render <= wake) {
+            synth_render_block(out, AUDIO_BLOCK_SIZE);
+            block_start = render;
+            continue;
+        }
+        t = wake;
+        uint32_t now = sim_note_time(t);
+        if (rate_change && rate == HOST_RATE && tm.events >= (long)song->events / 2) {
+            anchor_us += (now - anchor) * 1e6 / rate;
+            anchor = now;
+            rate = NEW_RATE;
+        }
+        posted_all = !seq_pump(&seq, now, now + SEQ_LOOKAHEAD, rate);
+        for (; seen != q->head; seen++) {
+            synth_event_t *ev = &q->ev[seen & (NOTE_QUEUE_SIZE - 1)];
+            if (ev->key == NOTE_ALL_OFF) continue;
+            // the event's song time, skipping notes off the keyboard
+            do {
+                song_next(&r, &e);
+                us += (uint64_t)e.delta * song->tick_us;
+            } while (e.note < SYNTH_TABLE_BASE_NOTE || e.note >= SYNTH_TABLE_BASE_NOTE + NUM_KEYS);
+            uint32_t ideal = anchor + (uint32_t)lround((us - anchor_us) * rate / 1e6);
+            uint32_t applied = (int32_t)(ev->time - synth_samples) >= 0 ? ev->time : synth_samples;
+            long err = (int32_t)(applied - ideal);
+            tm.events++;
+            if (err && stall) tm.stalled++;
+            else if (err) tm.off++;
+            if (err > tm.max_late) tm.max_late = err;
+            if (-err > tm.max_early) tm.max_early = -err;
+        }
+        stall = urand() < stall_p;
+        wake = t + 1000 + 300 * urand() + (stall ? STALL_US : 0);
+    }
+    return tm;
+}
+
+// seq_stop() after a key was pressed and the song struck some notes
+static bool check_stop(const song_t *song)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    sequencer_t seq;
+    bool ok = true;
+
+    host_reset();
+    host_params(synth_presets[PRESET_PIANO]);
+    // a key the songs do not play
+    const int key = NUM_KEYS - 1;
+    host_note(key, true);
+    seq_start(&seq, song, synth_samples, HOST_RATE, SYNTH_TABLE_BASE_NOTE);
+    int song_voices = 0;
+    for (int b = 0; b < 5000 && song_voices == 0; b++) {
+        seq_pump(&seq, synth_samples, synth_samples + SEQ_LOOKAHEAD, HOST_RATE);
+        synth_render_block(out, AUDIO_BLOCK_SIZE);
+        for (int s = 0; s < SYNTH_MAX_VOICES; s++) {
+            if (voices[s].held && voices[s].src == NOTE_SRC_SONG) song_voices++;
+        }
+    }
+    seq_stop(&seq, synth_samples);
+    for (int b = 0; b <= SEQ_LOOKAHEAD / AUDIO_BLOCK_SIZE; b++) synth_render_block(out, AUDIO_BLOCK_SIZE);
+
+    int slot = key_voice[key];
+    if (song_voices == 0) {
+        printf("  the song struck no notes\n");
+        ok = false;
+    }
+    if (slot < 0 || !voices[slot].held || voices[slot].src != NOTE_SRC_KEYS) {
+        printf("  the player's key was released\n");
+        ok = false;
+    }
+    for (int s = 0; s < SYNTH_MAX_VOICES; s++) {
+        if (voices[s].held && s != slot) {
+            printf("  song voice %d key %d still held\n", s, voices[s].key);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// seq_stop() with the song queue full of note-ons, then after a block
+static bool check_stop_full(const song_t *song)
+{
+    static uint16_t out[SYNTH_CHANNELS * AUDIO_BLOCK_SIZE];
+    note_queue_t *q = &note_queues[NOTE_SRC_SONG];
+    sequencer_t seq;
+    bool ok = true;
+
+    host_reset();
+    host_params(synth_presets[PRESET_PIANO]);
+    seq_start(&seq, song, synth_samples, HOST_RATE, SYNTH_TABLE_BASE_NOTE);
+    for (int k = 0; k < NOTE_QUEUE_SIZE; k++) synth_post_note(NOTE_SRC_SONG, k % NUM_KEYS, true, synth_samples);
+    if (seq_stop(&seq, synth_samples) || !seq.playing || q->dropped) {
+        printf("  stop on a full queue: playing %d, %u dropped\n", seq.playing, q->dropped);
+        ok = false;
+    }
+    synth_render_block(out, AUDIO_BLOCK_SIZE);
+    if (!seq_stop(&seq, synth_samples) || seq.playing) {
+        printf("  stop after the queue drained refused\n");
+        ok = false;
+    }
+    synth_render_block(out, AUDIO_BLOCK_SIZE);
+    for (int s = 0; s < SYNTH_MAX_VOICES; s++) {
+        if (voices[s].held) {
+            printf("  song voice %d key %d still held\n", s, voices[s].key);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main(void)
+{
+    static const struct {
+        const char *name;
+        double stall_p;
+        bool rate_change;
+    } runs[] = {
+        { "on time", 0, false },
+        { "stalls", STALL_P, false },
+        { "rate change", 0, true },
+    };
+    int failed = 0;
+
+    srand(2532);
+    printf("song timing, applied against ideal sample, %d Hz\n", HOST_RATE);
+    for (int i = 0; i < 3; i++) {
+        printf(" %s\n", runs[i].name);
+        for (int s = 0; s < NUM_SONGS; s++) {
+            timing_t tm = play(test_songs[s], runs[i].stall_p, runs[i].rate_change);
+            bool ok = tm.off == 0 && tm.max_early == 0;
+            printf("  song %d: %5ld events, %4ld off time, %4ld late after a stall, latest %+5ld  %s\n",
+                s + 1, tm.events, tm.off, tm.stalled, tm.max_late, ok ? "ok" : "FAIL");
+            if (!ok) failed++;
+        }
+    }
+
+    // a rate change while the next event is overdue counts back from start
+    sequencer_t seq;
+    seq_start(&seq, test_songs[0], 1000, HOST_RATE, SYNTH_TABLE_BASE_NOTE);
+    seq.start_us = 10000;
+    uint32_t back = seq_sample(&seq, 9000);
+    bool ok = back == 1000 - 28;
+    printf(" overdue event after a rate change: sample %u, expected %u  %s\n", back, 1000 - 28, ok ? "ok" : "FAIL");
+    if (!ok) failed++;
+
+    printf(" stop\n");
+    for (int s = 0; s < NUM_SONGS; s++) {
+        ok = check_stop(test_songs[s]) && check_stop_full(test_songs[s]);
+        printf("  song %d: %s\n", s + 1, ok ? "ok" : "FAIL");
+        if (!ok) failed++;
+    }
+    return failed != 0;
+}
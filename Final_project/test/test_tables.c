@@ -0,0 +1,42 @@
+// The generated tables against the arithmetic main() and protothread_FM
+// did at boot before gen-tables.py: sine_table, notes and the main DDS
+// increments at the 36 uSec rate must match bit for bit.
+#include <stdio.h>
+#include <math.h>
+#include "host.h"
+
+int main(void)
+{
+    int base_note = 36;
+    int alarm_period = 36;
+    int bad = 0;
+
+    for (int i = 0; i < 256; i++) {
+        fix v = float_to_fix(sin(2 * 3.1416 * i / 256));
+        if (v != sine_table[i]) {
+            printf("sine_table[%d] %d, boot %d\n", i, sine_table[i], v);
+            bad++;
+        }
+    }
+
+    float Fs = 1.0 / ((float)alarm_period * 1e-6);
+    if (sample_rates[0] != HOST_RATE) {
+        printf("sample_rates[0] %d, expected %d\n", sample_rates[0], HOST_RATE);
+        bad++;
+    }
+    for (int i = 0; i < NUM_KEYS; i++) {
+        float note = 440.0 * pow(2, (base_note + i - 69.0) / 12.0);
+        unsigned int inc = note * pow(2, 32) / Fs;
+        if (note != notes[i]) {
+            printf("notes[%d] %.9g, boot %.9g\n", i, notes[i], note);
+            bad++;
+        }
+        if (inc != note_inc_table[0][i]) {
+            printf("note_inc_table[0][%d] %u, boot %u\n", i, note_inc_table[0][i], inc);
+            bad++;
+        }
+    }
+
+    printf("tables against the boot arithmetic: %d mismatches\n", bad);
+    return bad != 0;
+}
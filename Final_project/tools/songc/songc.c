@@ -0,0 +1,163 @@
+/**
+ * songc - compiles a Standard MIDI File into a packed song
+ *
+ * Runs on the build machine. Reads the .mid with the same smf reader the
+ * firmware links, keeps the note events, bakes the tempo map into a
+ * fixed song tick and writes a C file with the packed bytes (see song.h)
+ * and the song_t that points at them.
+ *
+ * usage: songc [-t semitones] [-k track] [-r us] name in.mid out.c
+ *   -t  transpose every note, default 0
+ *   -k  only this track, default all tracks merged
+ *   -r  timing resolution in us, default 1000
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "smf.h"
+#include "song.h"
+
+typedef struct note {
+    uint64_t time_us;
+    unsigned char note;
+    unsigned char velocity;
+    bool on;
+} note_t;
+
+static uint64_t gcd(uint64_t a, uint64_t b) {
+    while (b) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: songc [-t semitones] [-k track] [-r us] name in.mid out.c\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    int transpose = 0;
+    int only_track = -1;
+    long resolution = 1000;
+    int arg = 1;
+
+    for (; arg < argc && argv[arg][0] == '-'; arg += 2) {
+        if (arg + 1 >= argc) usage();
+        if (!strcmp(argv[arg], "-t")) transpose = atoi(argv[arg + 1]);
+        else if (!strcmp(argv[arg], "-k")) only_track = atoi(argv[arg + 1]);
+        else if (!strcmp(argv[arg], "-r")) resolution = atol(argv[arg + 1]);
+        else usage();
+    }
+    if (argc - arg != 3 || resolution <= 0) usage();
+    const char *name = argv[arg];
+    const char *in_path = argv[arg + 1];
+    const char *out_path = argv[arg + 2];
+
+    // the whole file in one buffer, the reader works on it in place
+    FILE *f = fopen(in_path, "rb");
+    if (!f) {
+        perror(in_path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(size > 0 ? size : 1);
+    if (!data || fread(data, 1, size, f) != (size_t)size) {
+        fprintf(stderr, "%s: read failed\n", in_path);
+        return 1;
+    }
+    fclose(f);
+
+    smf_t smf;
+    smf_event_t e;
+    int status = smf_open(&smf, data, size);
+    if (status != SMF_OK) {
+        fprintf(stderr, "%s: not a type 0/1 MIDI file (%d)\n", in_path, status);
+        return 1;
+    }
+
+    // note events, on the resolution grid
+    note_t *notes = NULL;
+    long count = 0, capacity = 0, dropped = 0;
+    uint64_t tick = 0;
+    while (smf_next(&smf, &e)) {
+        if (e.type != SMF_NOTE_ON && e.type != SMF_NOTE_OFF) continue;
+        if (only_track >= 0 && e.track != only_track) continue;
+        int n = e.data1 + transpose;
+        if (n < 0 || n > SONG_NOTE_MASK) {
+            dropped++;
+            continue;
+        }
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 1024;
+            notes = realloc(notes, capacity * sizeof(note_t));
+            if (!notes) return 1;
+        }
+        note_t *t = &notes[count++];
+        t->time_us = (e.time_us + resolution / 2) / resolution * resolution;
+        t->note = n;
+        t->on = e.type == SMF_NOTE_ON;
+        t->velocity = e.data2;
+        // the song tick is the longest one every event falls on
+        tick = gcd(tick, t->time_us);
+    }
+    if (smf.error != SMF_OK) {
+        fprintf(stderr, "%s: malformed at track data (%d)\n", in_path, smf.error);
+        return 1;
+    }
+    if (tick == 0) tick = resolution;
+    if (tick > UINT32_MAX) tick = resolution;
+
+    uint8_t *packed = malloc(count * SONG_EVENT_MAX_BYTES + 1);
+    uint32_t packed_size = 0;
+    unsigned char velocity = SONG_DEFAULT_VELOCITY;
+    uint64_t last = 0;
+    for (long i = 0; i < count; i++) {
+        song_event_t ev;
+        uint64_t delta = (notes[i].time_us - last) / tick;
+        if (delta > UINT32_MAX >> 1) {
+            fprintf(stderr, "%s: gap too long at event %ld\n", in_path, i);
+            return 1;
+        }
+        ev.delta = delta;
+        ev.note = notes[i].note;
+        ev.on = notes[i].on;
+        ev.velocity = notes[i].velocity;
+        packed_size += song_encode(packed + packed_size, &ev, &velocity);
+        last = notes[i].time_us;
+    }
+
+    f = fopen(out_path, "w");
+    if (!f) {
+        perror(out_path);
+        return 1;
+    }
+    fprintf(f, "// generated by songc from %s, do not edit\n", in_path);
+    fprintf(f, "// %ld events, %u bytes, %llu us per tick\n",
+        count, packed_size, (unsigned long long)tick);
+    fprintf(f, "#include \"song.h\"\n\n");
+    fprintf(f, "static const uint8_t data[%u] = {\n", packed_size ? packed_size : 1);
+    for (uint32_t i = 0; i < packed_size; i += 16) {
+        fprintf(f, "   ");
+        for (uint32_t j = i; j < i + 16 && j < packed_size; j++) fprintf(f, " 0x%02x,", packed[j]);
+        fprintf(f, "\n");
+    }
+    if (!packed_size) fprintf(f, "    0\n");
+    fprintf(f, "};\n\n");
+    fprintf(f, "const song_t song_%s = {data, %u, %ld, %llu};\n",
+        name, packed_size, count, (unsigned long long)tick);
+    if (fclose(f)) {
+        perror(out_path);
+        return 1;
+    }
+    if (dropped) fprintf(stderr, "%s: %ld notes out of range after transposing\n", in_path, dropped);
+    free(packed);
+    free(notes);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * test_roundtrip - every song through songc and back
+ *
+ * The songs are compiled by songc as for the firmware and linked in.
+ * Each is decoded with song_next() and compared with the note events
+ * the smf reader gives for its .mid: same notes in the same order, the
+ * same press velocities, and every event within half a resolution step
+ * of its time in the file. song_encode() is also run on the extremes
+ * of the format, the longest delta and velocity changes.
+ *
+ * usage: test_roundtrip [-t semitones] [-r us] song.mid ...
+ *   in the order of ROUNDTRIP_SONGS, with songc's -t and -r
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "smf.h"
+#include "song.h"
+
+// the songs built into this test, X(name) for each song_<name>
+#define X(name) extern const song_t song_##name;
+ROUNDTRIP_SONGS
+#undef X
+#define X(name) &song_##name,
+static const song_t *const test_songs[] = { ROUNDTRIP_SONGS };
+#undef X
+#define NUM_TEST_SONGS (int)(sizeof(test_songs) / sizeof(test_songs[0]))
+
+static int check_song(const song_t *song, const char *path, int transpose, long resolution) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(size > 0 ? size : 1);
+    if (!data || fread(data, 1, size, f) != (size_t)size) {
+        fprintf(stderr, "%s: read failed\n", path);
+        return 1;
+    }
+    fclose(f);
+
+    smf_t smf;
+    smf_event_t e;
+    song_reader_t r;
+    song_event_t ev;
+    uint64_t time_us = 0, worst = 0;
+    long events = 0;
+    int failed = 0;
+    if (smf_open(&smf, data, size) != SMF_OK) {
+        fprintf(stderr, "%s: not a type 0/1 MIDI file\n", path);
+        return 1;
+    }
+    song_open(song, &r);
+    while (!failed && smf_next(&smf, &e)) {
+        if (e.type != SMF_NOTE_ON && e.type != SMF_NOTE_OFF) continue;
+        int n = e.data1 + transpose;
+        if (n < 0 || n > SONG_NOTE_MASK) continue;
+        if (!song_next(&r, &ev)) {
+            printf("%s: song ends after %ld of the file's events\n", path, events);
+            failed = 1;
+            break;
+        }
+        time_us += (uint64_t)ev.delta * song->tick_us;
+        uint64_t err = (time_us > e.time_us) ? time_us - e.time_us : e.time_us - time_us;
+        if (err > worst) worst = err;
+        bool on = e.type == SMF_NOTE_ON;
+        if (ev.note != n || ev.on != on || (on && ev.velocity != e.data2) || err > (uint64_t)resolution / 2) {
+            printf("%s event %ld: %s %d vel %d at %llu us, file has %s %d vel %d at %llu us\n", path, events,
+                ev.on ? "on" : "off", ev.note, ev.velocity, (unsigned long long)time_us,
+                on ? "on" : "off", n, e.data2, (unsigned long long)e.time_us);
+            failed = 1;
+        }
+        events++;
+    }
+    if (!failed && (song_next(&r, &ev) || r.pos != r.end || events != (long)song->events)) {
+        printf("%s: %ld events in the file, %lu in the song, %ld bytes left over\n", path, events,
+            (unsigned long)song->events, (long)(r.end - r.pos));
+        failed = 1;
+    }
+    printf("  %-40s %5ld events  %6lu bytes  (%ld as note_t)  worst %llu us  %s\n", path, events,
+        (unsigned long)song->size, events * 12, (unsigned long long)worst, failed ? "FAIL" : "ok");
+    free(data);
+    return failed;
+}
+
+// the format's extremes through song_encode() and song_next()
+static int check_encoder(void) {
+    static const song_event_t cases[] = {
+        { 0, 60, 100, true }, { 0, 60, 100, false }, { 1, 0, 1, true }, { 63, 127, 127, true },
+        { 64, 127, 127, false }, { 8191, 1, 64, true }, { 8192, 1, 64, true },
+        { UINT32_MAX >> 1, 5, 5, true }, { UINT32_MAX >> 1, 5, 5, false },
+    };
+    const int count = sizeof(cases) / sizeof(cases[0]);
+    uint8_t buf[sizeof(cases) / sizeof(cases[0]) * SONG_EVENT_MAX_BYTES];
+    unsigned char velocity = SONG_DEFAULT_VELOCITY;
+    uint32_t size = 0;
+    for (int i = 0; i < count; i++) size += song_encode(buf + size, &cases[i], &velocity);
+
+    song_t song = { buf, size, count, 1 };
+    song_reader_t r;
+    song_event_t ev;
+    int failed = 0;
+    song_open(&song, &r);
+    for (int i = 0; i < count; i++) {
+        const song_event_t *c = &cases[i];
+        if (!song_next(&r, &ev) || ev.delta != c->delta || ev.note != c->note || ev.on != c->on ||
+            (c->on && ev.velocity != c->velocity)) {
+            printf("  encoder case %d: delta %lu note %d does not come back\n", i, (unsigned long)c->delta, c->note);
+            failed = 1;
+        }
+    }
+    // a song cut anywhere inside its last event yields none of it
+    for (uint32_t cut = 1; cut < 5; cut++) {
+        song.size = size - cut;
+        song_open(&song, &r);
+        int n = 0;
+        while (song_next(&r, &ev)) n++;
+        if (n != count - 1) {
+            printf("  encoder: %d events from a song cut %lu bytes short\n", n, (unsigned long)cut);
+            failed = 1;
+        }
+    }
+    printf("  encoder: %d cases, %lu bytes  %s\n", count, (unsigned long)size, failed ? "FAIL" : "ok");
+    return failed;
+}
+
+int main(int argc, char **argv) {
+    int transpose = 0;
+    long resolution = 1000;
+    int arg = 1;
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2) {
+        if (!strcmp(argv[arg], "-t")) transpose = atoi(argv[arg + 1]);
+        else if (!strcmp(argv[arg], "-r")) resolution = atol(argv[arg + 1]);
+    }
+    if (argc - arg != NUM_TEST_SONGS) {
+        fprintf(stderr, "test_roundtrip: %d songs built in, %d files given\n", NUM_TEST_SONGS, argc - arg);
+        return 2;
+    }
+    int failed = check_encoder();
+    for (int i = 0; i < NUM_TEST_SONGS; i++) failed |= check_song(test_songs[i], argv[arg + i], transpose, resolution);
+    return failed;
+}
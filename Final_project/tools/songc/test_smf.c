@@ -0,0 +1,234 @@
+/**
+ * test_smf - the smf reader on random well formed MIDI files
+ *
+ * Each file is written here from random events: a tempo map track with
+ * text events, then up to three tracks of channel messages in and out
+ * of running status, note ons of velocity 0, sysex and meta events,
+ * with and without end of track. Tick and SMPTE divisions both occur.
+ * What the reader must give back is worked out alongside, merged by
+ * tick and track and timed through the tempo map, and compared event
+ * by event.
+ *
+ * usage: test_smf [files]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "smf.h"
+
+#define DEFAULT_FILES 2000
+#define TRACKS 4
+#define MAX_EVENTS 1024
+#define MAX_BYTES 16384
+
+typedef struct expected {
+    uint32_t tick;
+    uint64_t time_us;
+    int track, order;
+    smf_event_t e;
+} expected_t;
+
+static uint32_t rng = 88172645u;
+
+static uint32_t next_random(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint8_t file[MAX_BYTES];
+static size_t file_size;
+static expected_t expect[MAX_EVENTS];
+static int num_expected;
+
+static void put(uint8_t b) {
+    file[file_size++] = b;
+}
+
+static void put_varint(uint32_t v) {
+    uint8_t tmp[5];
+    int n = 0;
+    do {
+        tmp[n++] = v & 0x7f;
+        v >>= 7;
+    } while (v);
+    while (n > 1) put(tmp[--n] | 0x80);
+    put(tmp[0]);
+}
+
+static void put_be(uint32_t v, int bytes) {
+    while (bytes--) put(v >> (8 * bytes));
+}
+
+static expected_t *add_expected(uint32_t tick, int track, int order) {
+    expected_t *x = &expect[num_expected++];
+    memset(x, 0, sizeof(*x));
+    x->tick = tick;
+    x->track = track;
+    x->order = order;
+    x->e.tick = tick;
+    x->e.track = track;
+    return x;
+}
+
+static int by_tick_and_track(const void *a, const void *b) {
+    const expected_t *x = a, *y = b;
+    if (x->tick != y->tick) return x->tick < y->tick ? -1 : 1;
+    if (x->track != y->track) return x->track - y->track;
+    return x->order - y->order;
+}
+
+// one track chunk, the length filled in once the events are written
+static void write_track(int track) {
+    static const uint32_t gaps[] = { 0, 0, 1, 5, 100, 1000, 20000 };
+    static const uint8_t types[] = { 0x80, 0x90, 0x90, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0 };
+    uint32_t tick = 0, last = 0;
+    uint8_t running = 0;
+    int order = 0;
+    put('M'); put('T'); put('r'); put('k');
+    size_t length_at = file_size;
+    put_be(0, 4);
+
+    if (track == 0) {
+        // the tempo map, each change followed by a text event
+        int changes = 1 + next_random() % 6;
+        for (int i = 0; i < changes; i++) {
+            uint32_t tempo = 200000 + next_random() % 1300000;
+            tick += next_random() % 2001;
+            put_varint(tick - last);
+            last = tick;
+            put(0xff); put(SMF_TEMPO); put(3);
+            put_be(tempo, 3);
+            expected_t *x = add_expected(tick, track, order++);
+            x->e.type = SMF_TEMPO;
+            x->e.tempo = tempo;
+            put_varint(0);
+            put(0xff); put(0x01); put(3);
+            put('a'); put('b'); put('c');
+        }
+    }
+    else {
+        int events = next_random() % 300;
+        for (int i = 0; i < events; i++) {
+            tick += gaps[next_random() % 7];
+            put_varint(tick - last);
+            last = tick;
+            int kind = next_random() % 100;
+            if (kind < 5) {
+                // sysex, ends running status
+                put(0xf0); put_varint(3);
+                put(0x01); put(0x02); put(0xf7);
+                running = 0;
+                continue;
+            }
+            if (kind < 8) {
+                // meta text, the same
+                put(0xff); put(0x03); put_varint(2);
+                put('h'); put('i');
+                running = 0;
+                continue;
+            }
+            uint8_t status = types[next_random() % sizeof(types)] | (next_random() % 16);
+            uint8_t d1 = next_random() % 128, d2 = next_random() % 128;
+            bool one = (status & 0xf0) == SMF_PROGRAM || (status & 0xf0) == SMF_CHANNEL_PRESSURE;
+            if (status != running) put(status);
+            running = status;
+            put(d1);
+            if (!one) put(d2);
+            expected_t *x = add_expected(tick, track, order++);
+            x->e.type = status & 0xf0;
+            x->e.channel = status & 0x0f;
+            x->e.data1 = d1;
+            x->e.data2 = one ? 0 : d2;
+            if (x->e.type == SMF_NOTE_ON && d2 == 0) x->e.type = SMF_NOTE_OFF;
+        }
+    }
+    // a track may also just end with its chunk
+    if (track == 0 || next_random() % 5) {
+        put_varint(0);
+        put(0xff); put(0x2f); put(0);
+    }
+    uint32_t length = file_size - length_at - 4;
+    file[length_at] = length >> 24;
+    file[length_at + 1] = length >> 16;
+    file[length_at + 2] = length >> 8;
+    file[length_at + 3] = length;
+}
+
+// a random file and the events it must give
+static void make_file(void) {
+    static const uint16_t divisions[] = { 96, 384, 480, 0xe728 };  // the last is 25 fps, 40 per frame
+    uint16_t division = divisions[next_random() % 4];
+    int tracks = 1 + next_random() % TRACKS;
+    file_size = 0;
+    num_expected = 0;
+    put('M'); put('T'); put('h'); put('d');
+    put_be(6, 4);
+    put_be(1, 2);
+    put_be(tracks, 2);
+    put_be(division, 2);
+    for (int t = 0; t < tracks; t++) write_track(t);
+
+    qsort(expect, num_expected, sizeof(expected_t), by_tick_and_track);
+    // through the tempo map, each change timed at the tempo before it
+    uint32_t tempo = SMF_DEFAULT_TEMPO, tempo_tick = 0;
+    uint64_t tempo_us = 0;
+    for (int i = 0; i < num_expected; i++) {
+        expected_t *x = &expect[i];
+        if (division & 0x8000) {
+            x->time_us = (uint64_t)x->tick * 1000000 / (25 * 40);
+            continue;
+        }
+        x->time_us = tempo_us + (uint64_t)(x->tick - tempo_tick) * tempo / division;
+        if (x->e.type == SMF_TEMPO) {
+            tempo_us = x->time_us;
+            tempo_tick = x->tick;
+            tempo = x->e.tempo;
+        }
+    }
+}
+
+static bool same(const smf_event_t *a, const expected_t *x) {
+    return a->tick == x->tick && a->time_us == x->time_us && a->track == x->track && a->type == x->e.type &&
+        a->channel == x->e.channel && a->data1 == x->e.data1 && a->data2 == x->e.data2 &&
+        (a->type != SMF_TEMPO || a->tempo == x->e.tempo);
+}
+
+int main(int argc, char **argv) {
+    long files = argc > 1 ? atol(argv[1]) : DEFAULT_FILES;
+    long events = 0;
+    for (long f = 0; f < files; f++) {
+        make_file();
+        // exactly the file's bytes, as fuzz_smf does
+        uint8_t *data = malloc(file_size);
+        memcpy(data, file, file_size);
+        smf_t smf;
+        smf_event_t e;
+        int n = 0, status = smf_open(&smf, data, file_size);
+        if (status != SMF_OK) {
+            printf("file %ld: smf_open says %d\n", f, status);
+            return 1;
+        }
+        while (smf_next(&smf, &e)) {
+            if (n >= num_expected || !same(&e, &expect[n])) {
+                printf("file %ld event %d: tick %lu %llu us track %d type %x, expected tick %lu %llu us track %d type %x\n",
+                    f, n, (unsigned long)e.tick, (unsigned long long)e.time_us, e.track, e.type,
+                    n < num_expected ? (unsigned long)expect[n].tick : 0UL,
+                    n < num_expected ? (unsigned long long)expect[n].time_us : 0ULL,
+                    n < num_expected ? expect[n].track : -1, n < num_expected ? expect[n].e.type : 0);
+                return 1;
+            }
+            n++;
+        }
+        if (smf.error != SMF_OK || n != num_expected) {
+            printf("file %ld: %d of %d events, error %d\n", f, n, num_expected, smf.error);
+            return 1;
+        }
+        events += n;
+        free(data);
+    }
+    printf("%ld random files, %ld events, all as written\n", files, events);
+    return 0;
+}